@@ -176,6 +176,15 @@ static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
     glLoadIdentity();
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Compact vertices store fixed point positions and normalized UV as 16-bit integers: scale them back.
+    glScalef(1.0f / (float)IM_DRAWVERT_COMPACT_POS_SCALE, 1.0f / (float)IM_DRAWVERT_COMPACT_POS_SCALE, 1.0f);
+    glMatrixMode(GL_TEXTURE);
+    glPushMatrix();
+    glLoadIdentity();
+    glScalef(1.0f / (float)IM_DRAWVERT_COMPACT_UV_SCALE, 1.0f / (float)IM_DRAWVERT_COMPACT_UV_SCALE, 1.0f);
+    glMatrixMode(GL_MODELVIEW);
+#endif
 }
 
 // OpenGL2 Render function.
@@ -217,8 +226,13 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     {
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        glVertexPointer(2, GL_SHORT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, pos)));
+        glTexCoordPointer(2, GL_SHORT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, uv)));
+#else
         glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, pos)));
         glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, uv)));
+#endif
         glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, col)));
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
@@ -256,6 +270,10 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     glDisableClientState(GL_TEXTURE_COORD_ARRAY);
     glDisableClientState(GL_VERTEX_ARRAY);
     glBindTexture(GL_TEXTURE_2D, (GLuint)last_texture);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glMatrixMode(GL_TEXTURE);
+    glPopMatrix();
+#endif
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
     glMatrixMode(GL_PROJECTION);
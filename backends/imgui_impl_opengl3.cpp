@@ -6,7 +6,10 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
+//  [x] Renderer: Large meshes support (64k+ vertices) using 32-bit indices for those lists only (ImGuiBackendFlags_RendererHasIdx32) [Not on ES 2.0/WebGL 1.0]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Distance field font textures (ImFontAtlasFlags_DistanceField, ImTextureData::IsDistanceField). [Not on ES 2.0/WebGL 1.0 without OES_standard_derivatives]
+//  [X] Renderer: BC4 compressed font textures (ImGuiBackendFlags_RendererHasTexturesBC4, ImTextureData::CompressedPixels). [Desktop OpenGL 3.3+ only!]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +26,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Upload ImTextureData::CompressedPixels as GL_COMPRESSED_RED_RGTC1 (BC4) with a swizzle sampling alpha from red, when available (Desktop GL 3.3+).
+//  2026-10-18: OpenGL: Added support for distance field font textures (ImTextureData::IsDistanceField), sampled with a smoothstep() around the glyph edge.
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
@@ -218,6 +223,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ has GL_COMPRESSED_RED_RGTC1 textures (3.0+) and GL_TEXTURE_SWIZZLE_xxx (3.3+)
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_COMPRESSED_RED_RGTC1) && defined(GL_TEXTURE_SWIZZLE_A)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_COMPRESSION_RGTC
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -240,6 +250,7 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationDistanceField;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -249,7 +260,9 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasPolygonMode;
     bool            HasBindSampler;
     bool            HasClipOrigin;
+    bool            HasTextureCompressionRGTC;
     bool            UseBufferSubData;
+    bool            DistanceFieldEnabled;    // Current value of DistanceField uniform
     ImVector<char>  TempBuffer;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
@@ -368,6 +381,8 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;       // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    if (!bd->GlProfileIsES2)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32;      // We can honor ImDrawList::IdxBuffer32, allowing for large meshes without VtxOffset. (GL_UNSIGNED_INT indices are not core in ES 2.0)
 
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     platform_io.Renderer_TextureMaxWidth = platform_io.Renderer_TextureMaxHeight = (int)bd->MaxTextureSize;
@@ -403,6 +418,11 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     bd->HasBindSampler = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
 #endif
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_COMPRESSION_RGTC
+    bd->HasTextureCompressionRGTC = (!bd->GlProfileIsES2 && !bd->GlProfileIsES3 && bd->GlVersion >= 330);
+    if (bd->HasTextureCompressionRGTC)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTexturesBC4; // We can upload ImTextureData::CompressedPixels.
+#endif
 #ifdef IMGUI_IMPL_OPENGL_HAS_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -428,7 +448,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasIdx32 | ImGuiBackendFlags_RendererHasTexturesBC4);
     platform_io.ClearRendererHandlers();
     IM_DELETE(bd);
 
@@ -490,17 +510,24 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / (float)IM_DRAWVERT_COMPACT_POS_SCALE; // Compact vertices store fixed point positions: fold the scale into the projection matrix
+#else
+    const float S = 1.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { 2.0f/(R-L)*S, 0.0f,         0.0f,   0.0f },
+        { 0.0f,         2.0f/(T-B)*S, 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    glUniform1i(bd->AttribLocationDistanceField, 0);
+    bd->DistanceFieldEnabled = false;
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->HasBindSampler)
@@ -518,8 +545,13 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_SHORT,         GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
@@ -609,7 +641,9 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        const int idx_size = draw_list->GetIdxSize();
+        const GLenum idx_type = (idx_size == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->GetIdxCount() * idx_size;
         if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
@@ -623,12 +657,12 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
             }
             GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data));
-            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data));
+            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)draw_list->GetIdxData()));
         }
         else
         {
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
-            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
+            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->GetIdxData(), GL_STREAM_DRAW));
         }
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
@@ -656,12 +690,18 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
                 // Bind texture, Draw
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                const bool distance_field = (pcmd->TexRef._TexData != nullptr && pcmd->TexRef._TexData->IsDistanceField);
+                if (bd->DistanceFieldEnabled != distance_field)
+                {
+                    GL_CALL(glUniform1i(bd->AttribLocationDistanceField, distance_field ? 1 : 0));
+                    bd->DistanceFieldEnabled = distance_field;
+                }
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_size), (GLint)pcmd->VtxOffset));
                 else
 #endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_size)));
             }
         }
     }
@@ -742,6 +782,10 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
         const void* pixels = tex->GetPixels();
         GLuint gl_texture_id = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_COMPRESSION_RGTC
+        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+        const bool use_compressed = (bd->HasTextureCompressionRGTC && tex->CompressedPixels != nullptr);
+#endif
 
         // Upload texture to graphics system
         // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
@@ -753,6 +797,18 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
         GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_COMPRESSION_RGTC
+        if (use_compressed)
+        {
+            // BC4 blocks only store alpha: sample it from the red channel, and return white for color.
+            GL_CALL(glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RED_RGTC1, tex->Width, tex->Height, 0, tex->GetCompressedSizeInBytes(), tex->CompressedPixels));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+            GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+        }
+        else
+#endif
         GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex->Width, tex->Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
 
         // Store identifiers
@@ -771,6 +827,27 @@ void ImGui_ImplOpenGL3_UpdateTexture(ImTextureData* tex)
 
         GLuint gl_tex_id = (GLuint)(intptr_t)tex->TexID;
         GL_CALL(glBindTexture(GL_TEXTURE_2D, gl_tex_id));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_COMPRESSION_RGTC
+        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+        if (bd->HasTextureCompressionRGTC && tex->CompressedPixels != nullptr)
+        {
+            // Update rectangles are aligned to 4x4 blocks. Copy block rows to a contiguous buffer.
+            for (ImTextureRect& r : tex->Updates)
+            {
+                IM_ASSERT((r.x & 3) == 0 && (r.y & 3) == 0 && (r.w & 3) == 0 && (r.h & 3) == 0);
+                const int src_pitch = (r.w >> 2) * 8;
+                bd->TempBuffer.resize((r.h >> 2) * src_pitch);
+                char* out_p = bd->TempBuffer.Data;
+                for (int y = 0; y < r.h; y += 4, out_p += src_pitch)
+                    memcpy(out_p, tex->GetCompressedPixelsAt(r.x, r.y + y), src_pitch);
+                IM_ASSERT(out_p == bd->TempBuffer.end());
+                GL_CALL(glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.w, r.h, GL_COMPRESSED_RED_RGTC1, bd->TempBuffer.Size, bd->TempBuffer.Data));
+            }
+            tex->SetStatus(ImTextureStatus_OK);
+            GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture)); // Restore state
+            return;
+        }
+#endif
 #if GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
         GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, tex->Width));
         for (ImTextureRect& r : tex->Updates)
@@ -913,47 +990,82 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // Textures with ImTextureData::IsDistanceField store a signed distance field in their alpha channel (0.5 on glyph edges):
+    // we apply a smoothstep() over about one screen pixel around the edge, using derivatives to handle any scale.
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
+        "#ifdef GL_OES_standard_derivatives\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "#endif\n"
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool DistanceField;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture2D(Texture, Frag_UV.st);\n"
+        "#if !defined(GL_ES) || defined(GL_OES_standard_derivatives)\n"
+        "    if (DistanceField)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_color.a) * 0.5, 0.001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "#endif\n"
+        "    gl_FragColor = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform bool DistanceField;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (DistanceField)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_color.a) * 0.5, 0.001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool DistanceField;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (DistanceField)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_color.a) * 0.5, 0.001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool DistanceField;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (DistanceField)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_color.a) * 0.5, 0.001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -1012,6 +1124,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationDistanceField = glGetUniformLocation(bd->ShaderHandle, "DistanceField");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
@@ -59,6 +59,9 @@
 struct ImGui_ImplSDLRenderer2_Data
 {
     SDL_Renderer*   Renderer;       // Main viewport's renderer
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImVector<ImVec2> PosUvBuffer;   // Decoded positions/UV (interleaved), as SDL_RenderGeometryRaw() only takes floats
+#endif
 
     ImGui_ImplSDLRenderer2_Data()   { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -123,6 +126,10 @@ void ImGui_ImplSDLRenderer2_NewFrame()
 
 void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer* renderer)
 {
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImGui_ImplSDLRenderer2_Data* bd = ImGui_ImplSDLRenderer2_GetBackendData();
+#endif
+
     // If there's a scale factor set by the user, use that instead
     // If the user has specified a scale factor to SDL_Renderer already via SDL_RenderSetScale(), SDL will scale whatever we pass
     // to SDL_RenderGeometryRaw() by that scale factor. In that case we don't want to be also scaling it ourselves here.
@@ -176,6 +183,14 @@ void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
     {
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        bd->PosUvBuffer.resize(draw_list->VtxBuffer.Size * 2);
+        for (int vtx_n = 0; vtx_n < draw_list->VtxBuffer.Size; vtx_n++)
+        {
+            bd->PosUvBuffer.Data[vtx_n * 2 + 0] = vtx_buffer[vtx_n].pos;
+            bd->PosUvBuffer.Data[vtx_n * 2 + 1] = vtx_buffer[vtx_n].uv;
+        }
+#endif
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
@@ -204,8 +219,15 @@ void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
                 SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
                 SDL_RenderSetClipRect(renderer, &r);
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                const float* xy = &bd->PosUvBuffer.Data[pcmd->VtxOffset * 2 + 0].x;
+                const float* uv = &bd->PosUvBuffer.Data[pcmd->VtxOffset * 2 + 1].x;
+                const int xy_uv_stride = (int)sizeof(ImVec2) * 2;
+#else
                 const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
                 const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
+                const int xy_uv_stride = (int)sizeof(ImDrawVert);
+#endif
 #if SDL_VERSION_ATLEAST(2,0,19)
                 const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
 #else
@@ -215,9 +237,9 @@ void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
                 // Bind texture, Draw
                 SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
                 SDL_RenderGeometryRaw(renderer, tex,
-                    xy, (int)sizeof(ImDrawVert),
+                    xy, xy_uv_stride,
                     color, (int)sizeof(ImDrawVert),
-                    uv, (int)sizeof(ImDrawVert),
+                    uv, xy_uv_stride,
                     draw_list->VtxBuffer.Size - pcmd->VtxOffset,
                     idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
             }
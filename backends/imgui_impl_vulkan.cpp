@@ -5,6 +5,7 @@
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as texture identifier. Call ImGui_ImplVulkan_AddTexture() to register one. Read the FAQ about ImTextureID/ImTextureRef + https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: BC4 compressed font textures (ImGuiBackendFlags_RendererHasTexturesBC4, ImTextureData::CompressedPixels). Opt-in with init_info.UseTextureCompressionBC4.
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
 
 // The aim of imgui_impl_vulkan.h/.cpp is to be usable in your engine without any modification.
@@ -27,6 +28,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Vulkan: Added optional upload of ImTextureData::CompressedPixels as VK_FORMAT_BC4_UNORM_BLOCK. User needs to set init_info->UseTextureCompressionBC4 = true and enable the textureCompressionBC device feature.
 //  2025-10-15: Vulkan: Added IMGUI_IMPL_VULKAN_VOLK_FILENAME to configure path to volk.h header. (#9008)
 //  2025-09-26: *BREAKING CHANGE*: moved some fields in ImGui_ImplVulkan_InitInfo: init_info.RenderPass --> init_info.PipelineInfoMain.RenderPass, init_info.Subpass --> init_info.PipelineInfoMain.Subpass, init_info.MSAASamples --> init_info.PipelineInfoMain.MSAASamples, init_info.PipelineRenderingCreateInfo --> init_info.PipelineInfoMain.PipelineRenderingCreateInfo.
 //  2025-09-26: *BREAKING CHANGE*: renamed ImGui_ImplVulkan_MainPipelineCreateInfo to ImGui_ImplVulkan_PipelineInfo. Introduced very recently so shouldn't affect many users.
@@ -697,13 +699,15 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
         IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
         IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
         ImGui_ImplVulkan_Texture* backend_tex = IM_NEW(ImGui_ImplVulkan_Texture)();
+        const bool use_compressed = (v->UseTextureCompressionBC4 && tex->CompressedPixels != nullptr);
+        const VkFormat format = use_compressed ? VK_FORMAT_BC4_UNORM_BLOCK : VK_FORMAT_R8G8B8A8_UNORM;
 
         // Create the Image:
         {
             VkImageCreateInfo info = {};
             info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
             info.imageType = VK_IMAGE_TYPE_2D;
-            info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            info.format = format;
             info.extent.width = tex->Width;
             info.extent.height = tex->Height;
             info.extent.depth = 1;
@@ -734,7 +738,15 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
             info.image = backend_tex->Image;
             info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-            info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            info.format = format;
+            if (use_compressed)
+            {
+                // BC4 blocks only store alpha: sample it from the red channel, and return white for color.
+                info.components.r = VK_COMPONENT_SWIZZLE_ONE;
+                info.components.g = VK_COMPONENT_SWIZZLE_ONE;
+                info.components.b = VK_COMPONENT_SWIZZLE_ONE;
+                info.components.a = VK_COMPONENT_SWIZZLE_R;
+            }
             info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             info.subresourceRange.levelCount = 1;
             info.subresourceRange.layerCount = 1;
@@ -765,9 +777,13 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
         // Create the Upload Buffer:
         VkDeviceMemory upload_buffer_memory;
 
+        // (compressed textures are uploaded as rows of 4x4 blocks: the atlas aligns update rectangles to blocks)
         VkBuffer upload_buffer;
-        VkDeviceSize upload_pitch = upload_w * tex->BytesPerPixel;
-        VkDeviceSize upload_size = AlignBufferSize(upload_h * upload_pitch, bd->NonCoherentAtomSize);
+        const bool use_compressed = (v->UseTextureCompressionBC4 && tex->CompressedPixels != nullptr);
+        IM_ASSERT(!use_compressed || ((upload_x & 3) == 0 && (upload_y & 3) == 0 && (upload_w & 3) == 0 && (upload_h & 3) == 0));
+        const int upload_rows = use_compressed ? upload_h / 4 : upload_h;
+        VkDeviceSize upload_pitch = use_compressed ? (upload_w / 4) * 8 : upload_w * tex->BytesPerPixel;
+        VkDeviceSize upload_size = AlignBufferSize(upload_rows * upload_pitch, bd->NonCoherentAtomSize);
         {
             VkBufferCreateInfo buffer_info = {};
             buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -794,8 +810,8 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             char* map = nullptr;
             err = vkMapMemory(v->Device, upload_buffer_memory, 0, upload_size, 0, (void**)(&map));
             check_vk_result(err);
-            for (int y = 0; y < upload_h; y++)
-                memcpy(map + upload_pitch * y, tex->GetPixelsAt(upload_x, upload_y + y), (size_t)upload_pitch);
+            for (int y = 0; y < upload_rows; y++)
+                memcpy(map + upload_pitch * y, use_compressed ? tex->GetCompressedPixelsAt(upload_x, upload_y + y * 4) : tex->GetPixelsAt(upload_x, upload_y + y), (size_t)upload_pitch);
             VkMappedMemoryRange range[1] = {};
             range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
             range[0].memory = upload_buffer_memory;
@@ -1277,6 +1293,8 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    if (info->UseTextureCompressionBC4)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTexturesBC4; // We can upload ImTextureData::CompressedPixels.
 
     // Sanity checks
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
@@ -1315,7 +1333,7 @@ void ImGui_ImplVulkan_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasTexturesBC4);
     platform_io.ClearRendererHandlers();
     IM_DELETE(bd);
 }
@@ -119,6 +119,10 @@ struct ImGui_ImplVulkan_InitInfo
     // Need to explicitly enable VK_KHR_dynamic_rendering extension to use this, even for Vulkan 1.3 + setup PipelineInfoMain.PipelineRenderingCreateInfo.
     bool                            UseDynamicRendering;
 
+    // (Optional) BC4 compressed font textures (ImFontAtlasFlags_CompressedTexture)
+    // Need to explicitly enable VkPhysicalDeviceFeatures::textureCompressionBC on the device to use this.
+    bool                            UseTextureCompressionBC4;
+
     // (Optional) Allocation, Debugging
     const VkAllocationCallbacks*    Allocator;
     void                            (*CheckVkResultFn)(VkResult err);
@@ -66,6 +66,11 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Hash IDs with known size (e.g. ImHashData(), GetID(const void*), GetID(begin, end)) 8 bytes per step using CRC32 instructions, instead of 1 byte per step.
+// Requires SSE 4.2 (e.g. '-msse4.2') or ARMv8 CRC extension (e.g. '-march=armv8-a+crc') to be enabled at compile time, otherwise ignored. Ignored when using IMGUI_USE_LEGACY_CRC32_ADLER.
+// Computes the same CRC32c values, so IDs and .ini data are unchanged. Zero-terminated labels (the common case, e.g. Button("OK")) are still hashed 1 byte per step.
+//#define IMGUI_USE_FAST_CRC32
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -120,6 +125,15 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (16-bit fixed point positions, 16-bit normalized UV) instead of the default 20 bytes one.
+// Reduces vertex bandwidth e.g. for software rasterizers or remote streaming. Positions are limited to -4096..+4095 with 1/8 pixel precision.
+// Your renderer backend will need to support it (imgui_impl_opengl2, imgui_impl_opengl3, imgui_impl_sdlrenderer2, imgui_impl_sdlrenderer3 do).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
+//---- Make ImGuiStorage use an open-addressing hash index by default, instead of a sorted array (see ImGuiStorage::SetUseHashIndex()).
+// O(1) insertion instead of O(N), e.g. when opening many thousands of tree nodes at once, at the cost of more memory.
+//#define IMGUI_USE_STORAGE_HASH_INDEX
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -73,6 +73,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiFrameArena
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -1185,6 +1186,11 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 #include <TargetConditionals.h>
 #endif
 
+// [Unix] OS specific includes
+#if defined(__unix__) || defined(__APPLE__)
+#include <sched.h>          // sched_yield
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -1246,6 +1252,7 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float NAV_ACTIVATE_HIGHLIGHT_TIMER             = 0.10f;    // Time to highlight an item activated by a shortcut.
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
+static const int   WINDOWS_HIT_GRID_MIN_COUNT               = 64;       // Build a grid to find hovered window when there are at least that many active windows.
 
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET_MOUSE = ImVec2(16, 10);      // Multiplied by g.Style.MouseCursorScale
@@ -1283,6 +1290,8 @@ static void             ItemHandleShortcut(ImGuiID id);
 // Window Focus
 static int              FindWindowFocusIndex(ImGuiWindow* window);
 static void             UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_created, ImGuiWindowFlags new_flags);
+static void             UpdateWindowsDisplayOrder(int start_idx, int end_idx);
+static void             UpdateWindowsHitGrid();
 
 // Navigation
 static void             NavUpdate();
@@ -1326,6 +1335,7 @@ static void             UpdateFontsNewFrame();
 static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
+static void             UpdateTextLayoutCacheNewFrame();
 static void             UpdateSettings();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
@@ -1383,6 +1393,9 @@ static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_d
 static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+static thread_local int     GImAllocatorDebugHookSkipThread = 0;    // Set on threads running our jobs: debug allocation hooks are not thread-safe. See DebugAllocHookBeginSkipThread().
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO, ImGuiPlatformIO)
@@ -1555,6 +1568,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDrawDataMergeLists = false;
+    ConfigTextLayoutCache = false;
+    ConfigWindowsHitGrid = false;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2278,7 +2294,7 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#if !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_ENABLE_ARM_CRC32)
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2324,6 +2340,35 @@ static const ImU32 GCrc32LookupTable[256] =
 };
 #endif
 
+#ifdef IMGUI_ENABLE_FAST_CRC32
+// CRC32c of 1 and 8 bytes using CRC32 instructions (see IMGUI_USE_FAST_CRC32). Gives the same result as hashing the 8 bytes one by one.
+static inline ImU32 ImCrc32U8(ImU32 crc, unsigned char c)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC)
+    return _mm_crc32_u8(crc, c);
+#else
+    return __crc32cb(crc, c);
+#endif
+}
+
+static inline ImU32 ImCrc32U64(ImU32 crc, const unsigned char* data)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC) && (defined(__x86_64__) || defined(_M_X64))
+    ImU64 v;
+    memcpy(&v, data, 8);
+    return (ImU32)_mm_crc32_u64(crc, v);
+#elif defined(IMGUI_ENABLE_SSE4_2_CRC)
+    ImU32 v[2];
+    memcpy(v, data, 8);
+    return _mm_crc32_u32(_mm_crc32_u32(crc, v[0]), v[1]);
+#else
+    ImU64 v;
+    memcpy(&v, data, 8);
+    return __crc32cd(crc, v);
+#endif
+}
+#endif
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
@@ -2332,7 +2377,13 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
     const unsigned char *data_end = (const unsigned char*)data_p + data_size;
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#if defined(IMGUI_ENABLE_FAST_CRC32)
+    for (; data + 8 <= data_end; data += 8)
+        crc = ImCrc32U64(crc, data);
+    while (data < data_end)
+        crc = ImCrc32U8(crc, *data++);
+    return ~crc;
+#elif !defined(IMGUI_ENABLE_SSE4_2_CRC)
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data < data_end)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
@@ -2360,6 +2411,43 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_FAST_CRC32
+    // Zero-terminated: hash one byte per step, as we can't read past the terminator (measuring the string first was slower for typical labels).
+    // Known size: hash 8 bytes per step, unless they contain a '#' which may start a "###" marker.
+    if (data_size == 0)
+    {
+        while (unsigned char c = *data++)
+        {
+            if (c == '#' && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = ImCrc32U8(crc, c);
+        }
+    }
+    else
+    {
+        const unsigned char* data_end = data + data_size;
+        while (data < data_end)
+        {
+            if (data_end - data >= 8)
+            {
+                ImU64 word;
+                memcpy(&word, data, 8);
+                word ^= 0x2323232323232323ULL; // Bytes equal to '#' become zero
+                if (((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) == 0)
+                {
+                    crc = ImCrc32U64(crc, data);
+                    data += 8;
+                    continue;
+                }
+            }
+            unsigned char c = *data++;
+            if (c == '#' && data_end - data >= 2 && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = ImCrc32U8(crc, c);
+        }
+    }
+    return ~crc;
+#else
 #ifndef IMGUI_ENABLE_SSE4_2_CRC
     const ImU32* crc32_lut = GCrc32LookupTable;
 #endif
@@ -2391,6 +2479,7 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
         }
     }
     return ~crc;
+#endif
 }
 
 // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
@@ -2484,6 +2573,16 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Let other threads run, e.g. while waiting for a job running on a worker thread.
+// Without a known OS function this returns immediately, making callers busy-wait.
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+void    ImThreadYield()     { ::SwitchToThread(); }
+#elif defined(__unix__) || defined(__APPLE__)
+void    ImThreadYield()     { sched_yield(); }
+#else
+void    ImThreadYield()     {}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2822,18 +2921,114 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+// Hash index: linear probing into a power of two table of indices into Data[], kept at most half full.
+// Keys are generally already hashes, but we still mix them as some are e.g. small sequential integers.
+static inline int StorageHashSlot(ImGuiID key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 16)) & (ImU32)mask);
+}
+
+static void StorageBuildHashIndex(ImGuiStorage* storage)
+{
+    int size = 16;
+    while (size < storage->Data.Size * 2)
+        size <<= 1;
+    storage->HashIndex.resize(size);
+    memset(storage->HashIndex.Data, 0xFF, (size_t)size * sizeof(int));
+    const int mask = size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        int slot = StorageHashSlot(storage->Data.Data[n].key, mask);
+        while (storage->HashIndex.Data[slot] != -1)
+            slot = (slot + 1) & mask;
+        storage->HashIndex.Data[slot] = n;
+    }
+}
+
+// Find pair, or return NULL.
+static ImGuiStoragePair* StorageFindPair(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (storage->IsUsingHashIndex())
+    {
+        if (storage->HashIndex.Size == 0)
+            return NULL;
+        const int mask = storage->HashIndex.Size - 1;
+        for (int slot = StorageHashSlot(key, mask); ; slot = (slot + 1) & mask)
+        {
+            const int idx = storage->HashIndex.Data[slot];
+            if (idx == -1)
+                return NULL;
+            if (data[idx].key == key)
+                return &data[idx];
+        }
+    }
+    ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+    if (it == data + storage->Data.Size || it->key != key)
+        return NULL;
+    return it;
+}
+
+// Find pair, or insert 'new_pair' if missing.
+static ImGuiStoragePair* StorageFindOrAddPair(ImGuiStorage* storage, const ImGuiStoragePair& new_pair)
+{
+    const ImGuiID key = new_pair.key;
+    if (storage->IsUsingHashIndex())
+    {
+        if ((storage->Data.Size + 1) * 2 > storage->HashIndex.Size)
+        {
+            if (ImGuiStoragePair* it = StorageFindPair(storage, key))
+                return it;
+            storage->Data.push_back(new_pair);
+            StorageBuildHashIndex(storage);
+            return &storage->Data.back();
+        }
+        const int mask = storage->HashIndex.Size - 1;
+        int slot = StorageHashSlot(key, mask);
+        for (; storage->HashIndex.Data[slot] != -1; slot = (slot + 1) & mask)
+            if (storage->Data.Data[storage->HashIndex.Data[slot]].key == key)
+                return &storage->Data.Data[storage->HashIndex.Data[slot]];
+        storage->HashIndex.Data[slot] = storage->Data.Size;
+        storage->Data.push_back(new_pair);
+        return &storage->Data.back();
+    }
+    ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, key);
+    if (it == storage->Data.Data + storage->Data.Size || it->key != key)
+        it = storage->Data.insert(it, new_pair);
+    return it;
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
-    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (IsUsingHashIndex())
+        StorageBuildHashIndex(this);
+    else
+        ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+}
+
+void ImGuiStorage::SetUseHashIndex(bool enabled)
+{
+    const bool was_enabled = IsUsingHashIndex();
+    HashIndexMode = enabled ? 1 : -1;
+    if (enabled == was_enabled)
+        return;
+    if (enabled)
+    {
+        StorageBuildHashIndex(this);
+    }
+    else
+    {
+        HashIndex.clear();
+        ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    }
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2843,27 +3038,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrAddPair(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2873,28 +3061,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrAddPair(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrAddPair(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    StorageFindOrAddPair(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2904,20 +3081,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    StorageFindOrAddPair(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    StorageFindOrAddPair(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -3109,6 +3278,58 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
 }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiFrameArena
+//-----------------------------------------------------------------------------
+
+void* ImGuiFrameArena::alloc(size_t size)
+{
+    IM_ASSERT(size <= (size_t)-1 / 4 && "Allocation too large."); // Size computations below can't overflow
+    size = IM_MEMALIGN(size, 16);
+    if (Blocks.Size == 0 || BlockUsed + size > Blocks.back().Size)
+    {
+        // Start a new block, at least twice larger than the previous one
+        const size_t prev_size = (Blocks.Size > 0) ? Blocks.back().Size : 0;
+        ImGuiFrameArenaBlock block;
+        block.Size = ImMax(ImMax(size, (size_t)4096), (prev_size <= (size_t)-1 / 4) ? prev_size * 2 : prev_size);
+        block.Data = (char*)IM_ALLOC(block.Size);
+        Blocks.push_back(block);
+        BlockUsed = 0;
+    }
+    void* ptr = Blocks.back().Data + BlockUsed;
+    BlockUsed += size;
+    UsedSize += size;
+    return ptr;
+}
+
+void ImGuiFrameArena::reset()
+{
+    HighWaterSize = ImMax(HighWaterSize, UsedSize);
+    const size_t total_size = capacity();
+    if (total_size > 1024 * 1024 && UsedSize < total_size / 4)
+    {
+        clear(); // Release memory after a spike (e.g. pasting a large text)
+    }
+    else if (Blocks.Size > 1)
+    {
+        // Merge blocks into a single one sized for last frame, so next frames using as much memory won't need to allocate
+        ImGuiFrameArenaBlock block;
+        block.Size = UsedSize;
+        clear();
+        block.Data = (char*)IM_ALLOC(block.Size);
+        Blocks.push_back(block);
+    }
+    BlockUsed = UsedSize = 0;
+}
+
+void ImGuiFrameArena::clear()
+{
+    for (ImGuiFrameArenaBlock& block : Blocks)
+        IM_FREE(block.Data);
+    Blocks.clear();
+    BlockUsed = UsedSize = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -3739,6 +3960,173 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
     return text_display_end;
 }
 
+// Text layout cache (io.ConfigTextLayoutCache)
+// - Entries are keyed by a hash of text contents, font, baked font size and wrap width. A copy of the text is kept to detect hash collisions.
+// - Entries are rebuilt if glyphs of any baked font were discarded since they were built (see ImFontAtlasBuilder::BakedClearedCount).
+// - Entries are only evicted in NewFrame(), so returned pointers are valid for the whole frame.
+// - With need_glyphs == false (CalcTextSize()) only the size is computed and stored: glyphs are added when the same text is rendered.
+const ImFontTextLayout* ImGui::FindOrBuildTextLayout(ImFont* font, float size, const char* text, const char* text_end, float wrap_width, bool need_glyphs)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigTextLayoutCache)
+        return NULL;
+    if (!text_end)
+        text_end = text + ImStrlen(text);
+    const int text_len = (int)(text_end - text);
+    if (text_len > IM_TEXTLAYOUT_CACHE_MAX_TEXT_LEN)
+        return NULL;
+    ImFontAtlasBuilder* builder = font->OwnerAtlas->Builder;
+    if (builder == NULL || builder->ReadOnlyForThreads)
+        return NULL;
+    if (wrap_width <= 0.0f)
+        wrap_width = 0.0f;
+
+    const ImGuiID baked_id = font->GetFontBaked(size)->BakedId;
+    ImGuiTextLayoutCacheEntry* entry = g.TextLayoutCacheLastEntry;
+    if (entry != NULL && (entry->HasGlyphs || !need_glyphs) && entry->BakedClearedCount == builder->BakedClearedCount && entry->Matches(font, baked_id, size, wrap_width, text, text_len))
+    {
+        g.TextLayoutCacheHits++;
+        return &entry->Layout;
+    }
+
+    struct { ImFont* Font; ImGuiID BakedId; float Size; float WrapWidth; } key_data;
+    memset(&key_data, 0, sizeof(key_data)); // Clear padding
+    key_data.Font = font;
+    key_data.BakedId = baked_id;
+    key_data.Size = size;
+    key_data.WrapWidth = wrap_width;
+    const ImGuiID key = ImHashData(text, (size_t)text_len, ImHashData(&key_data, sizeof(key_data)));
+
+    int* p_index = g.TextLayoutCacheMap.GetIntRef(key, -1);
+    if (*p_index != -1)
+    {
+        entry = g.TextLayoutCache[*p_index];
+        entry->LastUsedFrame = g.FrameCount;
+        g.TextLayoutCacheLastEntry = entry;
+        if ((entry->HasGlyphs || !need_glyphs) && entry->BakedClearedCount == builder->BakedClearedCount && entry->Matches(font, baked_id, size, wrap_width, text, text_len))
+        {
+            g.TextLayoutCacheHits++;
+            return &entry->Layout;
+        }
+    }
+    else
+    {
+        *p_index = g.TextLayoutCache.Size;
+        entry = IM_NEW(ImGuiTextLayoutCacheEntry)();
+        entry->Key = key;
+        entry->LastUsedFrame = g.FrameCount;
+        g.TextLayoutCache.push_back(entry);
+        g.TextLayoutCacheLastEntry = entry;
+    }
+
+    // Build (or rebuild on hash collision / invalidated glyphs / glyphs missing)
+    g.TextLayoutCacheMisses++;
+    entry->Font = font;
+    entry->BakedId = baked_id;
+    entry->Size = size;
+    entry->WrapWidth = wrap_width;
+    entry->Text.resize(text_len);
+    memcpy(entry->Text.Data, text, (size_t)text_len);
+    if (need_glyphs)
+    {
+        ImFontBuildTextLayout(font, size, text, text_end, wrap_width, ImDrawTextFlags_None, &entry->Layout);
+    }
+    else
+    {
+        entry->Layout.Size = ImFontCalcTextSizeEx(font, size, FLT_MAX, wrap_width, text, text_end, text_end, NULL, NULL, ImDrawTextFlags_None);
+        entry->Layout.Glyphs.clear();
+    }
+    entry->HasGlyphs = need_glyphs;
+    entry->BakedClearedCount = builder->BakedClearedCount;
+    return &entry->Layout;
+}
+
+// Evict entries not used during last frame while above IM_TEXTLAYOUT_CACHE_SIZE.
+// - Entries are scanned round-robin in small batches (scaled by last frame misses so eviction keeps up with new entries), instead of sorting them all every frame.
+// - Evicted slots are filled by swapping with the last entry. Their keys are left in the map as -1 and purged when they outnumber live entries.
+static void ImGui::UpdateTextLayoutCacheNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    g.TextLayoutCacheLastEntry = NULL;
+    g.TextLayoutCacheHitsLastFrame = g.TextLayoutCacheHits;
+    g.TextLayoutCacheMissesLastFrame = g.TextLayoutCacheMisses;
+    g.TextLayoutCacheHits = g.TextLayoutCacheMisses = 0;
+    if (!g.IO.ConfigTextLayoutCache && g.TextLayoutCache.Size > 0)
+    {
+        g.TextLayoutCache.clear_delete();
+        g.TextLayoutCacheMap.Clear();
+        g.TextLayoutCacheEvictCursor = 0;
+        return;
+    }
+    if (g.TextLayoutCache.Size <= IM_TEXTLAYOUT_CACHE_SIZE)
+        return;
+
+    ImVector<ImGuiTextLayoutCacheEntry*>& entries = g.TextLayoutCache;
+    ImGuiStorage& map = g.TextLayoutCacheMap;
+    const int scan_count = ImMin(entries.Size, IM_TEXTLAYOUT_CACHE_EVICT_BATCH + g.TextLayoutCacheMissesLastFrame * 4);
+    for (int scan_n = 0; scan_n < scan_count && entries.Size > IM_TEXTLAYOUT_CACHE_SIZE; scan_n++)
+    {
+        if (g.TextLayoutCacheEvictCursor >= entries.Size)
+            g.TextLayoutCacheEvictCursor = 0;
+        const int n = g.TextLayoutCacheEvictCursor;
+        ImGuiTextLayoutCacheEntry* entry = entries[n];
+        if (entry->LastUsedFrame >= g.FrameCount - 1)
+        {
+            g.TextLayoutCacheEvictCursor++;
+            continue;
+        }
+        map.SetInt(entry->Key, -1);
+        IM_DELETE(entry);
+        entries[n] = entries.back();
+        entries.pop_back();
+        if (n < entries.Size)
+            map.SetInt(entries[n]->Key, n);
+    }
+
+    // Purge evicted keys from map
+    if (map.Data.Size > entries.Size * 2)
+    {
+        map.Data.resize(0);
+        map.Data.reserve(entries.Size);
+        for (int n = 0; n < entries.Size; n++)
+            map.Data.push_back(ImGuiStoragePair(entries[n]->Key, n));
+        map.BuildSortByKey();
+    }
+}
+
+// Draw text using the text layout cache when enabled, otherwise same as ImDrawList::AddText().
+static void AddTextWithLayoutCache(ImDrawList* draw_list, ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigTextLayoutCache || (col & IM_COL32_A_MASK) == 0)
+    {
+        draw_list->AddText(font, font_size, pos, col, text_begin, text_end, wrap_width, cpu_fine_clip_rect);
+        return;
+    }
+    ImVec4 clip_rect = draw_list->_CmdHeader.ClipRect;
+    if (cpu_fine_clip_rect)
+    {
+        clip_rect.x = ImMax(clip_rect.x, cpu_fine_clip_rect->x);
+        clip_rect.y = ImMax(clip_rect.y, cpu_fine_clip_rect->y);
+        clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
+        clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
+    }
+    if (IM_TRUNC(pos.y) > clip_rect.w) // Early out before hashing, like RenderText()
+        return;
+
+    if (font == NULL)
+        font = draw_list->_Data->Font;
+    if (font_size == 0.0f)
+        font_size = draw_list->_Data->FontSize;
+    const ImFontTextLayout* layout = ImGui::FindOrBuildTextLayout(font, font_size, text_begin, text_end, wrap_width);
+    if (layout == NULL)
+    {
+        draw_list->AddText(font, font_size, pos, col, text_begin, text_end, wrap_width, cpu_fine_clip_rect);
+        return;
+    }
+    ImFontRenderTextLayout(font, draw_list, font_size, pos, col, clip_rect, layout, (cpu_fine_clip_rect != NULL) ? ImDrawTextFlags_CpuFineClip : ImDrawTextFlags_None);
+}
+
 // Internal ImGui functions to render text
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
@@ -3761,7 +4149,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 
     if (text != text_display_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
+        AddTextWithLayoutCache(window->DrawList, g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_display_end);
     }
@@ -3777,7 +4165,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        AddTextWithLayoutCache(window->DrawList, g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -3808,11 +4196,11 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     if (need_clipping)
     {
         ImVec4 fine_clip_rect(clip_min->x, clip_min->y, clip_max->x, clip_max->y);
-        draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, &fine_clip_rect);
+        AddTextWithLayoutCache(draw_list, NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, &fine_clip_rect);
     }
     else
     {
-        draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
+        AddTextWithLayoutCache(draw_list, NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
     }
 }
 
@@ -4071,12 +4459,18 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
     if (shared_font_atlas == NULL)
         IO.Fonts->OwnerContext = this;
+    DrawListsRecordingOnThreads = false;
+    TextLayoutCacheLastEntry = NULL;
+    TextLayoutCacheHits = TextLayoutCacheMisses = 0;
+    TextLayoutCacheHitsLastFrame = TextLayoutCacheMissesLastFrame = 0;
+    TextLayoutCacheEvictCursor = 0;
     WithinEndChildID = 0;
     TestEngine = NULL;
 
     InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
     InputEventsNextEventId = 1;
 
+    WindowsById.SetUseHashIndex(true); // O(1) FindWindowByID() with thousands of windows
     WindowsActiveCount = 0;
     WindowsBorderHoverPadding = 0.0f;
     CurrentWindow = NULL;
@@ -4261,6 +4655,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     DebugItemPickerMouseButton = ImGuiMouseButton_Left;
     DebugItemPickerBreakId = 0;
     DebugFlashStyleColorTime = 0.0f;
+    DebugDrawCmdsCountBeforeMerge = 0;
     DebugFlashStyleColorIdx = ImGuiCol_COUNT;
 
     // Same as DebugBreakClearData(). Those fields are scattered in their respective subsystem to stay in hot-data locations
@@ -4355,6 +4750,11 @@ void ImGui::Shutdown()
         }
     }
     g.DrawListSharedData.TempBuffer.clear();
+    g.DrawListSharedDataThreads.clear();
+    g.TextLayoutCache.clear_delete();
+    g.TextLayoutCacheMap.Clear();
+    g.TextLayoutCacheLastEntry = NULL;
+    g.TextLayoutCacheEvictCursor = 0;
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4373,6 +4773,9 @@ void ImGui::Shutdown()
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
+    g.WindowsHitGrid.Valid = false;
+    g.WindowsHitGrid.CellWindows.clear();
+    g.FrameArena.clear();
     g.NavWindow = NULL;
     g.HoveredWindow = g.HoveredWindowUnderMovingWindow = NULL;
     g.ActiveIdWindow = NULL;
@@ -4481,6 +4884,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     FontRefSize = 0.0f;
     FontWindowScale = FontWindowScaleParents = 1.0f;
     SettingsOffset = -1;
+    FocusOrder = DisplayOrder = -1;
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
     DrawList->_SetDrawListSharedData(&Ctx->DrawListSharedData);
@@ -4516,6 +4920,13 @@ static void SetCurrentWindow(ImGuiWindow* window)
     }
 }
 
+// Memory is valid until next NewFrame(), and released all at once: never call MemFree() on it.
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.alloc(size);
+}
+
 void ImGui::GcCompactTransientMiscBuffers()
 {
     ImGuiContext& g = *GImGui;
@@ -4524,6 +4935,11 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.InputTextLineIndex.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.TextLayoutCache.clear_delete();
+    g.TextLayoutCacheMap.Clear();
+    g.TextLayoutCacheLastEntry = NULL;
+    g.TextLayoutCacheEvictCursor = 0;
+    g.FrameArena.clear();
     TableGcCompactSettings();
     for (ImFontAtlas* atlas : g.FontAtlases)
         atlas->CompactCache();
@@ -4541,8 +4957,6 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
-    window->DC.ItemWidthStack.clear();
-    window->DC.TextWrapPosStack.clear();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
@@ -4970,8 +5384,10 @@ void* ImGui::MemAlloc(size_t size)
 {
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+    if (GImAllocatorDebugHookSkipThread == 0)
+        if (ImGuiContext* ctx = GImGui)
+            if (!ctx->DrawListsRecordingOnThreads) // May be called from multiple threads
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -4980,13 +5396,31 @@ void* ImGui::MemAlloc(size_t size)
 void ImGui::MemFree(void* ptr)
 {
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    if (ptr != NULL)
+    if (ptr != NULL && GImAllocatorDebugHookSkipThread == 0)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (!ctx->DrawListsRecordingOnThreads)
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Called by jobs which may run on worker threads (e.g. glyph loading): skip debug allocation hooks on current thread, as they are not thread-safe.
+// Other threads, including main thread, keep recording allocations.
+void ImGui::DebugAllocHookBeginSkipThread()
+{
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    GImAllocatorDebugHookSkipThread++;
+#endif
+}
+
+void ImGui::DebugAllocHookEndSkipThread()
+{
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    IM_ASSERT(GImAllocatorDebugHookSkipThread > 0);
+    GImAllocatorDebugHookSkipThread--;
+#endif
+}
+
 // We record the number of allocation in recent frames, as a way to audit/sanitize our guiding principles of "no allocations on idle/repeating frames"
 void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size)
 {
@@ -5126,6 +5560,64 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// Register per-thread shared data so ImDrawList instances using it are kept in sync with font atlas changes (texture and UV updates).
+void ImGui::AddDrawListSharedDataForThread(ImDrawListSharedData* data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(data != &g.DrawListSharedData && !g.DrawListSharedDataThreads.contains(data));
+    IM_ASSERT(!g.DrawListsRecordingOnThreads);
+    data->CopySettingsFrom(&g.DrawListSharedData);
+    g.DrawListSharedDataThreads.push_back(data);
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        ImFontAtlasAddDrawListSharedData(atlas, data);
+}
+
+void ImGui::RemoveDrawListSharedDataForThread(ImDrawListSharedData* data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.DrawListSharedDataThreads.contains(data));
+    IM_ASSERT(!g.DrawListsRecordingOnThreads);
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        ImFontAtlasRemoveDrawListSharedData(atlas, data);
+    g.DrawListSharedDataThreads.find_erase(data);
+}
+
+// Prepare for recording ImDrawList instances owned by registered per-thread shared data from worker threads.
+// Lists are reset and setup with the current font texture and a fullscreen clipping rectangle.
+void ImGui::BeginDrawListsRecordingOnThreads()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.WithinFrameScope && "Forgot to call NewFrame()?");
+    IM_ASSERT(!g.DrawListsRecordingOnThreads && "Forgot to call EndDrawListsRecordingOnThreads()?");
+    g.DrawListsRecordingOnThreads = true;
+
+    // Resolve current font size on the main thread, so worker threads never need to create an ImFontBaked for it.
+    if (g.Font != NULL)
+        g.Font->GetFontBaked(g.FontSize);
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        ImFontAtlasSetReadOnlyForThreads(atlas, true);
+
+    for (ImDrawListSharedData* data : g.DrawListSharedDataThreads)
+    {
+        data->CopySettingsFrom(&g.DrawListSharedData);
+        for (ImDrawList* draw_list : data->DrawLists)
+        {
+            draw_list->_ResetForNewFrame();
+            draw_list->PushTexture(g.IO.Fonts->TexRef);
+            draw_list->PushClipRectFullScreen();
+        }
+    }
+}
+
+void ImGui::EndDrawListsRecordingOnThreads()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.DrawListsRecordingOnThreads && "Mismatched BeginDrawListsRecordingOnThreads()/EndDrawListsRecordingOnThreads() calls!");
+    g.DrawListsRecordingOnThreads = false;
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        ImFontAtlasSetReadOnlyForThreads(atlas, false);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -5368,12 +5860,14 @@ static void SetupDrawListSharedData()
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
-    if (g.Style.AntiAliasedLinesUseTex && !(g.IO.Fonts->Flags & ImFontAtlasFlags_NoBakedLines))
+    if (g.Style.AntiAliasedLinesUseTex && !(g.IO.Fonts->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_DistanceField)))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdx32) && sizeof(ImDrawIdx) == 2)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset | ImDrawListFlags_AllowIdx32; // Record large meshes using VtxOffset, promoted to 32-bit indices in AddDrawListToDrawDataEx()
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
 }
 
@@ -5398,6 +5892,7 @@ void ImGui::NewFrame()
 
     g.Time += g.IO.DeltaTime;
     g.FrameCount += 1;
+    g.FrameArena.reset();
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -5422,6 +5917,7 @@ void ImGui::NewFrame()
     // Setup current font and draw list shared data
     SetupDrawListSharedData();
     UpdateFontsNewFrame();
+    UpdateTextLayoutCacheNewFrame();
 
     g.WithinFrameScope = true;
 
@@ -5734,6 +6230,118 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
     draw_data->Textures = &ImGui::GetPlatformIO().Textures;
 }
 
+// [EXPERIMENTAL] Merge consecutive draw lists of a viewport into fewer lists, so draw commands may be merged across lists (io.ConfigDrawDataMergeLists)
+// - Lists are concatenated in order and only consecutive commands are merged, so rendering order is preserved.
+// - Consecutive commands using the same texture are merged when they have the same clipping rectangle, or when the geometry
+//   of one command is entirely inside the clipping rectangles of both (e.g. window background vs window contents).
+//   The geometry test uses clipping rectangles rounded down, matching how backends convert them to scissor rectangles.
+// - Lists with callbacks or promoted to 32-bit indices, and lists not fitting in a merged list with 16-bit indices, are output as-is.
+// - Costs a copy of vertices + a pass over indices on CPU. Return number of draw commands after merging.
+static int MergeDrawDataLists(ImGuiViewportP* viewport)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawData* draw_data = &viewport->DrawDataP;
+    ImVector<ImDrawList*>& src_lists = viewport->DrawDataBuilder.LayerData1; // Unused after FlattenDrawDataIntoSingleLayer()
+    IM_ASSERT(src_lists.Size == 0);
+    src_lists.swap(draw_data->CmdLists);
+
+    const int max_vtx_count = (sizeof(ImDrawIdx) == 2) ? (1 << 16) : INT_MAX;
+    int merged_lists_count = 0;
+    int draw_cmds_count = 0;
+    ImDrawList* dst_list = NULL;
+    ImRect dst_cmd_bb;          // Bounding box of geometry in last command of dst_list
+    bool dst_cmd_clipped = false;// Does last command of dst_list needs its exact clipping rectangle?
+    for (ImDrawList* src_list : src_lists)
+    {
+        bool can_merge = (src_list->IdxBuffer32.Size == 0 && src_list->VtxBuffer.Size <= max_vtx_count);
+        for (const ImDrawCmd& cmd : src_list->CmdBuffer)
+            if (cmd.UserCallback != NULL)
+                can_merge = false;
+        if (!can_merge)
+        {
+            draw_data->CmdLists.push_back(src_list);
+            draw_cmds_count += src_list->CmdBuffer.Size;
+            dst_list = NULL;
+            continue;
+        }
+        if (dst_list == NULL || dst_list->VtxBuffer.Size + src_list->VtxBuffer.Size > max_vtx_count)
+        {
+            if (merged_lists_count == viewport->DrawDataMergedLists.Size)
+            {
+                ImDrawList* new_list = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+                new_list->_OwnerName = "##MergedDrawList";
+                viewport->DrawDataMergedLists.push_back(new_list);
+            }
+            dst_list = viewport->DrawDataMergedLists[merged_lists_count++];
+            dst_list->VtxBuffer.resize(0);
+            dst_list->IdxBuffer.resize(0);
+            dst_list->CmdBuffer.resize(0);
+            draw_data->CmdLists.push_back(dst_list);
+        }
+
+        // Copy vertices
+        const unsigned int vtx_base = (unsigned int)dst_list->VtxBuffer.Size;
+        dst_list->VtxBuffer.resize(dst_list->VtxBuffer.Size + src_list->VtxBuffer.Size);
+        memcpy(dst_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.size_in_bytes());
+
+        // Copy indices and commands, merging commands when possible
+        const ImDrawVert* src_vtx = src_list->VtxBuffer.Data;
+        for (const ImDrawCmd& src_cmd : src_list->CmdBuffer)
+        {
+            if (src_cmd.ElemCount == 0)
+                continue;
+            const int idx_offset = dst_list->IdxBuffer.Size;
+            dst_list->IdxBuffer.resize(idx_offset + (int)src_cmd.ElemCount);
+            const ImDrawIdx* src_idx = src_list->IdxBuffer.Data + src_cmd.IdxOffset;
+            ImDrawIdx* dst_idx = dst_list->IdxBuffer.Data + idx_offset;
+            ImRect bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+            {
+                const unsigned int vtx_idx = src_idx[n] + src_cmd.VtxOffset;
+                bb.Add(src_vtx[vtx_idx].pos);
+                dst_idx[n] = (ImDrawIdx)(vtx_idx + vtx_base);
+            }
+            const ImVec4& clip = src_cmd.ClipRect;
+            const bool clipped = !(bb.Min.x >= clip.x && bb.Min.y >= clip.y && bb.Max.x <= ImTrunc(clip.z) && bb.Max.y <= ImTrunc(clip.w));
+
+            ImDrawCmd* dst_cmd = dst_list->CmdBuffer.Size > 0 ? &dst_list->CmdBuffer.back() : NULL;
+            if (dst_cmd != NULL && dst_cmd->TexRef._TexData == src_cmd.TexRef._TexData && dst_cmd->TexRef._TexID == src_cmd.TexRef._TexID)
+            {
+                ImVec4& dst_clip = dst_cmd->ClipRect;
+                bool merge = true;
+                if (dst_clip.x == clip.x && dst_clip.y == clip.y && dst_clip.z == clip.z && dst_clip.w == clip.w)
+                    dst_cmd_clipped |= clipped;
+                else if (!clipped && bb.Min.x >= dst_clip.x && bb.Min.y >= dst_clip.y && bb.Max.x <= ImTrunc(dst_clip.z) && bb.Max.y <= ImTrunc(dst_clip.w))
+                    {} // New geometry fits in current clip rect
+                else if (!dst_cmd_clipped && dst_cmd_bb.Min.x >= clip.x && dst_cmd_bb.Min.y >= clip.y && dst_cmd_bb.Max.x <= ImTrunc(clip.z) && dst_cmd_bb.Max.y <= ImTrunc(clip.w))
+                    { dst_clip = clip; dst_cmd_clipped = clipped; } // Current geometry fits in new clip rect
+                else if (!dst_cmd_clipped && !clipped)
+                    dst_clip = ImVec4(ImMin(dst_clip.x, clip.x), ImMin(dst_clip.y, clip.y), ImMax(dst_clip.z, clip.z), ImMax(dst_clip.w, clip.w)); // Neither need clipping
+                else
+                    merge = false;
+                if (merge)
+                {
+                    IM_ASSERT(dst_cmd->IdxOffset + dst_cmd->ElemCount == (unsigned int)idx_offset);
+                    dst_cmd->ElemCount += src_cmd.ElemCount;
+                    dst_cmd_bb.Add(bb);
+                    continue;
+                }
+            }
+            ImDrawCmd new_cmd = src_cmd;
+            new_cmd.VtxOffset = 0;
+            new_cmd.IdxOffset = (unsigned int)idx_offset;
+            dst_list->CmdBuffer.push_back(new_cmd);
+            dst_cmd_bb = bb;
+            dst_cmd_clipped = clipped;
+        }
+    }
+    for (int n = 0; n < merged_lists_count; n++)
+        draw_cmds_count += viewport->DrawDataMergedLists[n]->CmdBuffer.Size;
+    draw_data->CmdListsCount = draw_data->CmdLists.Size;
+    src_lists.resize(0);
+    return draw_cmds_count;
+}
+
 // Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
 // - When using this function it is sane to ensure that float are perfectly rounded to integer values,
 //   so that e.g. (int)(max.x-min.x) in user's render produce correct result.
@@ -5924,6 +6532,8 @@ void ImGui::EndFrame()
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
+    UpdateWindowsDisplayOrder(0, g.Windows.Size);
+    UpdateWindowsHitGrid();
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     UpdateTexturesEndFrame();
@@ -5988,7 +6598,8 @@ void ImGui::Render()
         RenderMouseCursor(g.IO.MousePos, g.Style.MouseCursorScale, g.MouseCursor, IM_COL32_WHITE, IM_COL32_BLACK, IM_COL32(0, 0, 0, 48));
 
     // Setup ImDrawData structures for end-user
-    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = g.IO.MetricsRenderDrawCmds = 0;
+    g.DebugDrawCmdsCountBeforeMerge = 0;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -6000,9 +6611,17 @@ void ImGui::Render()
         // We call _PopUnusedDrawCmd() last thing, as RenderDimmedBackgrounds() rely on a valid command being there (especially in docking branch).
         ImDrawData* draw_data = &viewport->DrawDataP;
         IM_ASSERT(draw_data->CmdLists.Size == draw_data->CmdListsCount);
+        int draw_cmds_count = 0;
         for (ImDrawList* draw_list : draw_data->CmdLists)
+        {
             draw_list->_PopUnusedDrawCmd();
+            draw_cmds_count += draw_list->CmdBuffer.Size;
+        }
+        g.DebugDrawCmdsCountBeforeMerge += draw_cmds_count;
+        if (g.IO.ConfigDrawDataMergeLists)
+            draw_cmds_count = MergeDrawDataLists(viewport);
 
+        g.IO.MetricsRenderDrawCmds += draw_cmds_count;
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
@@ -6032,7 +6651,11 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    ImVec2 text_size;
+    if (const ImFontTextLayout* layout = FindOrBuildTextLayout(font, font_size, text, text_display_end, wrap_width, false))
+        text_size = layout->Size;
+    else
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -6061,9 +6684,27 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+
+    // Only test windows overlapping 'pos' when we have a grid built by last EndFrame() (see UpdateWindowsHitGrid())
+    ImGuiWindow** windows = g.Windows.Data;
+    int windows_count = g.Windows.Size;
+    ImGuiWindowsHitGrid* grid = &g.WindowsHitGrid;
+    if (grid->Valid && grid->Padding.x == padding_for_resize.x && grid->Padding.y == padding_for_resize.y)
     {
-        ImGuiWindow* window = g.Windows[i];
+        windows_count = 0;
+        if (pos.x >= grid->Bounds.Min.x && pos.y >= grid->Bounds.Min.y && pos.x < grid->Bounds.Max.x && pos.y < grid->Bounds.Max.y)
+        {
+            const int cell_x = ImClamp((int)((pos.x - grid->Bounds.Min.x) * grid->CellSizeInv.x), 0, grid->CellsX - 1);
+            const int cell_y = ImClamp((int)((pos.y - grid->Bounds.Min.y) * grid->CellSizeInv.y), 0, grid->CellsY - 1);
+            const int cell_n = cell_y * grid->CellsX + cell_x;
+            windows = grid->CellWindows.Data + grid->CellStart[cell_n];
+            windows_count = grid->CellStart[cell_n + 1] - grid->CellStart[cell_n];
+        }
+    }
+
+    for (int i = windows_count - 1; i >= 0; i--)
+    {
+        ImGuiWindow* window = windows[i];
         IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
         if (!window->WasActive || window->Hidden)
             continue;
@@ -6107,6 +6748,103 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
         *out_hovered_window_under_moving_window = hovered_window_under_moving_window;
 }
 
+// Build a uniform grid over rectangles of active windows, so FindHoveredWindowEx() calls only test windows overlapping the given position.
+// - Called in EndFrame() after sorting windows. Windows which will have WasActive set in next NewFrame() are registered into every cell
+//   their padded OuterRectClipped overlaps, in display order. Other conditions (Hidden, NoMouseInputs, hit test hole) are tested on lookup.
+// - The grid stays valid, across frames and for queries made during a frame, until display order changes (UpdateWindowsDisplayOrder()),
+//   a window rectangle changes (Begin()) or the set of active windows changes: mostly static layouts don't need to rebuild it.
+// - Only built with io.ConfigWindowsHitGrid and many active windows: testing a few rectangles is faster than building the grid.
+static void ImGui::UpdateWindowsHitGrid()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowsHitGrid* grid = &g.WindowsHitGrid;
+    if (!g.IO.ConfigWindowsHitGrid)
+    {
+        grid->Valid = false;
+        if (grid->CellWindows.Capacity > 0)
+            *grid = ImGuiWindowsHitGrid(); // Free memory
+        return;
+    }
+
+    // Keep grid when nothing it depends on changed
+    const ImVec2 padding = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+    if (grid->Valid && grid->Padding == padding)
+    {
+        bool active_windows_changed = false;
+        for (ImGuiWindow* window : g.Windows)
+            if (window->Active != window->WasActive)
+            {
+                active_windows_changed = true;
+                break;
+            }
+        if (!active_windows_changed)
+            return;
+    }
+    grid->Valid = false;
+
+    // Gather padded rectangles of active windows, in display order
+    grid->Windows.resize(0);
+    grid->Rects.resize(0);
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (!window->Active)
+            continue;
+        ImRect r(window->OuterRectClipped.Min - padding, window->OuterRectClipped.Max + padding);
+        if (r.Min.x > r.Max.x || r.Min.y > r.Max.y)
+            continue;
+        bounds.Add(r);
+        grid->Windows.push_back(window);
+        grid->Rects.push_back(r);
+    }
+    if (grid->Windows.Size < WINDOWS_HIT_GRID_MIN_COUNT)
+    {
+        grid->CellsX = grid->CellsY = 0;
+        grid->CellWindows.resize(0);
+        return;
+    }
+
+    // About one cell per window, up to 32x32 cells
+    const int cells_xy = ImClamp((int)ImSqrt((float)grid->Windows.Size), 1, 32);
+    grid->CellsX = grid->CellsY = cells_xy;
+    grid->Bounds = bounds;
+    grid->Padding = padding;
+    grid->CellSizeInv.x = (bounds.GetWidth() > 0.0f) ? cells_xy / bounds.GetWidth() : 0.0f;
+    grid->CellSizeInv.y = (bounds.GetHeight() > 0.0f) ? cells_xy / bounds.GetHeight() : 0.0f;
+
+    // Two passes: count windows per cell, then store them. Use CellStart[n + 1] as a counter/write cursor for cell n.
+    const int cells_count = cells_xy * cells_xy;
+    grid->CellStart.resize(cells_count + 1);
+    memset(grid->CellStart.Data, 0, (size_t)grid->CellStart.size_in_bytes());
+    for (int pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+        {
+            for (int n = 0; n < cells_count; n++)
+                grid->CellStart[n + 1] += grid->CellStart[n];
+            grid->CellWindows.resize(grid->CellStart[cells_count]);
+            memmove(grid->CellStart.Data + 1, grid->CellStart.Data, (size_t)cells_count * sizeof(int)); // Shift so CellStart[n + 1] is the write cursor of cell n
+        }
+        for (int window_n = 0; window_n < grid->Windows.Size; window_n++)
+        {
+            const ImRect& r = grid->Rects[window_n];
+            const int x0 = ImClamp((int)((r.Min.x - bounds.Min.x) * grid->CellSizeInv.x), 0, cells_xy - 1);
+            const int y0 = ImClamp((int)((r.Min.y - bounds.Min.y) * grid->CellSizeInv.y), 0, cells_xy - 1);
+            const int x1 = ImClamp((int)((r.Max.x - bounds.Min.x) * grid->CellSizeInv.x), 0, cells_xy - 1);
+            const int y1 = ImClamp((int)((r.Max.y - bounds.Min.y) * grid->CellSizeInv.y), 0, cells_xy - 1);
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                {
+                    int* cursor = &grid->CellStart[y * cells_xy + x + 1];
+                    if (pass == 1)
+                        grid->CellWindows[*cursor] = grid->Windows[window_n];
+                    (*cursor)++;
+                }
+        }
+    }
+    grid->Valid = true;
+}
+
 bool ImGui::IsItemActive()
 {
     ImGuiContext& g = *GImGui;
@@ -6529,9 +7267,15 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
     InitOrLoadWindowSettings(window, settings);
 
     if (flags & ImGuiWindowFlags_NoBringToFrontOnFocus)
+    {
         g.Windows.push_front(window); // Quite slow but rare and only once
+        ImGui::UpdateWindowsDisplayOrder(0, g.Windows.Size);
+    }
     else
+    {
         g.Windows.push_back(window);
+        window->DisplayOrder = g.Windows.Size - 1;
+    }
 
     return window;
 }
@@ -7219,30 +7963,74 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
 
 // [EXPERIMENTAL] Called by Begin(). NextWindowData is valid at this point.
 // This is designed as a toy/test-bed for
+// - When skipping refresh, the window DrawList is left untouched from its last refresh and added as-is to ImDrawData in Render(): no copy is involved.
+// - We refresh when any state affecting drawn contents changed since last refresh, including transitions (e.g. the frame where the window stops
+//   being hovered or focused), otherwise the reused contents could keep e.g. hovered colors or point to a discarded font atlas texture.
 void ImGui::UpdateWindowSkipRefresh(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
     window->SkipRefresh = false;
     if ((g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasRefreshPolicy) == 0)
+    {
+        window->SkipRefreshInputsHash = 0; // Contents are refreshed without tracking inputs: invalidate.
         return;
+    }
     if (g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_TryToAvoidRefresh)
     {
-        // FIXME-IDLE: Tests for e.g. mouse clicks or keyboard while focused.
+        const ImGuiWindowRefreshFlags refresh_flags = g.NextWindowData.RefreshFlagsVal;
+        const bool is_hovered = g.HoveredWindow && (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window));
+        const bool is_focused = g.NavWindow && (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window));
+        const bool is_active = g.ActiveId != 0 && g.ActiveIdWindow && (window->RootWindow == g.ActiveIdWindow->RootWindow || IsWindowWithinBeginStackOf(g.ActiveIdWindow->RootWindow, window));
+
+        // Compare state affecting drawn contents with the one from last frame
+        // (ScrollTarget is set by e.g. mouse wheel or SetScrollY() before Begin() applies it to Scroll)
+        struct { ImVec2 Pos, Size, Scroll, ScrollTarget; float FontSize; int FontTexUniqueID; bool Collapsed, Hovered, Focused, Active; } inputs;
+        memset(&inputs, 0, sizeof(inputs));
+        inputs.Pos = window->Pos;
+        inputs.Size = window->Size;
+        inputs.Scroll = window->Scroll;
+        inputs.ScrollTarget = window->ScrollTarget;
+        inputs.FontSize = g.FontSize;
+        inputs.FontTexUniqueID = (g.Font && g.Font->OwnerAtlas->TexData) ? g.Font->OwnerAtlas->TexData->UniqueID : -1;
+        inputs.Collapsed = window->Collapsed;
+        inputs.Hovered = is_hovered;
+        inputs.Focused = is_focused;
+        inputs.Active = is_active;
+        const ImGuiID inputs_hash = ImHashData(&inputs, sizeof(inputs));
+        const bool inputs_changed = (window->SkipRefreshInputsHash != inputs_hash);
+        const bool refresh_requested = window->SkipRefreshRequested;
+        window->SkipRefreshInputsHash = inputs_hash;
+        window->SkipRefreshRequested = false;
+
+        if (inputs_changed || refresh_requested)
+            return;
         if (window->Appearing) // If currently appearing
             return;
         if (window->Hidden) // If was hidden (previous frame)
             return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnHover) && g.HoveredWindow)
-            if (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window))
-                return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow)
-            if (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window))
-                return;
+        if (is_active) // If an item is active (e.g. dragging a slider with mouse outside of window)
+            return;
+        if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnHover) && is_hovered)
+            return;
+        if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnFocus) && is_focused)
+            return;
+        if (refresh_flags & ImGuiWindowRefreshFlags_RefreshOnInput)
+            for (const ImGuiInputEvent& e : g.InputEventsTrail)
+                if (e.Type != ImGuiInputEventType_MousePos)
+                    return;
         window->DrawList = NULL;
         window->SkipRefresh = true;
     }
 }
 
+// [EXPERIMENTAL] Child windows are refreshed along with their parent, so we flag the root window.
+void ImGui::RequestWindowRefresh(ImGuiWindow* window)
+{
+    window->SkipRefreshRequested = true;
+    if (window->RootWindow)
+        window->RootWindow->SkipRefreshRequested = true;
+}
+
 static void SetWindowActiveForSkipRefresh(ImGuiWindow* window)
 {
     window->Active = true;
@@ -7309,6 +8097,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->LastTimeActive = (float)g.Time;
         window->BeginOrderWithinParent = 0;
         window->BeginOrderWithinContext = (short)(g.WindowsActiveCount++);
+        window->DC.ItemWidthStack.reset(); // Storage from previous frame was released by NewFrame()
+        window->DC.TextWrapPosStack.reset();
     }
     else
     {
@@ -7753,8 +8543,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect host_rect = ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip) ? parent_window->ClipRect : viewport_rect;
         const ImRect outer_rect = window->Rect();
         const ImRect title_bar_rect = window->TitleBarRect();
+        const ImRect outer_rect_clipped_prev = window->OuterRectClipped;
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        if (window->OuterRectClipped.Min != outer_rect_clipped_prev.Min || window->OuterRectClipped.Max != outer_rect_clipped_prev.Max)
+            g.WindowsHitGrid.Valid = false; // See UpdateWindowsHitGrid()
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -7905,8 +8698,6 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             window->ItemWidthDefault = ImTrunc(g.FontSize * 16.0f);
         window->DC.ItemWidth = window->ItemWidthDefault;
         window->DC.TextWrapPos = -1.0f; // disabled
-        window->DC.ItemWidthStack.resize(0);
-        window->DC.TextWrapPosStack.resize(0);
         if (flags & ImGuiWindowFlags_Modal)
             window->DC.ModalDimBgColor = ColorConvertFloat4ToU32(GetStyleColorVec4(ImGuiCol_ModalWindowDimBg));
 
@@ -8773,6 +9564,7 @@ static void ImGui::UpdateTexturesNewFrame()
     {
         if (atlas->OwnerContext == &g)
         {
+            atlas->RendererHasTexturesBC4 = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexturesBC4) != 0;
             ImFontAtlasUpdateNewFrame(atlas, g.FrameCount, has_textures);
         }
         else
@@ -8802,6 +9594,11 @@ static void ImGui::UpdateTexturesEndFrame()
         }
     for (ImTextureData* tex : g.UserTextures)
         g.PlatformIO.Textures.push_back(tex);
+
+    // Encode pending changes of compressed textures (see ImFontAtlasFlags_CompressedTexture)
+    for (ImTextureData* tex : g.PlatformIO.Textures)
+        if (tex->CompressedPixels != NULL)
+            ImTextureDataUpdateCompressedPixels(tex);
 }
 
 void ImGui::UpdateFontsNewFrame()
@@ -8870,6 +9667,8 @@ void ImGui::RegisterFontAtlas(ImFontAtlas* atlas)
     atlas->RefCount++;
     g.FontAtlases.push_back(atlas);
     ImFontAtlasAddDrawListSharedData(atlas, &g.DrawListSharedData);
+    for (ImDrawListSharedData* data : g.DrawListSharedDataThreads)
+        ImFontAtlasAddDrawListSharedData(atlas, data);
     for (ImTextureData* tex : atlas->TexList)
         tex->RefCount = (unsigned short)atlas->RefCount;
 }
@@ -8879,6 +9678,8 @@ void ImGui::UnregisterFontAtlas(ImFontAtlas* atlas)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(atlas->RefCount > 0);
     ImFontAtlasRemoveDrawListSharedData(atlas, &g.DrawListSharedData);
+    for (ImDrawListSharedData* data : g.DrawListSharedDataThreads)
+        ImFontAtlasRemoveDrawListSharedData(atlas, data);
     g.FontAtlases.find_erase(atlas);
     atlas->RefCount--;
     for (ImTextureData* tex : atlas->TexList)
@@ -10792,6 +11593,7 @@ static void ImGui::ErrorCheckEndFrameSanityChecks()
 
     IM_ASSERT(g.CurrentWindowStack.Size == 1);
     IM_ASSERT(g.CurrentWindowStack[0].Window->IsFallbackWindow);
+    IM_ASSERT(!g.DrawListsRecordingOnThreads && "Forgot to call EndDrawListsRecordingOnThreads()?");
 }
 
 // Save current stack sizes. Called e.g. by NewFrame() and by Begin() but may be called for manual recovery.
@@ -12667,7 +13469,7 @@ static void ImGui::UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_c
     const bool child_flag_changed = new_is_explicit_child != window->IsExplicitChild;
     if ((just_created || child_flag_changed) && !new_is_explicit_child)
     {
-        IM_ASSERT(!g.WindowsFocusOrder.contains(window));
+        IM_ASSERT(window->FocusOrder == -1);
         g.WindowsFocusOrder.push_back(window);
         window->FocusOrder = (short)(g.WindowsFocusOrder.Size - 1);
     }
@@ -12710,13 +13512,10 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
     ImGuiWindow* current_front_window = g.Windows.back();
     if (current_front_window == window || current_front_window->RootWindow == window) // Cheap early out (could be better)
         return;
-    for (int i = g.Windows.Size - 2; i >= 0; i--) // We can ignore the top-most window
-        if (g.Windows[i] == window)
-        {
-            memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
-            g.Windows[g.Windows.Size - 1] = window;
-            break;
-        }
+    const int i = FindWindowDisplayIndex(window);
+    memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
+    g.Windows[g.Windows.Size - 1] = window;
+    UpdateWindowsDisplayOrder(i, g.Windows.Size);
 }
 
 void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
@@ -12724,13 +13523,10 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
     ImGuiContext& g = *GImGui;
     if (g.Windows[0] == window)
         return;
-    for (int i = 0; i < g.Windows.Size; i++)
-        if (g.Windows[i] == window)
-        {
-            memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
-            g.Windows[0] = window;
-            break;
-        }
+    const int i = FindWindowDisplayIndex(window);
+    memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
+    g.Windows[0] = window;
+    UpdateWindowsDisplayOrder(0, i + 1);
 }
 
 void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_window)
@@ -12746,19 +13542,37 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
         size_t copy_bytes = (pos_beh - pos_wnd - 1) * sizeof(ImGuiWindow*);
         memmove(&g.Windows.Data[pos_wnd], &g.Windows.Data[pos_wnd + 1], copy_bytes);
         g.Windows[pos_beh - 1] = window;
+        UpdateWindowsDisplayOrder(pos_wnd, pos_beh);
     }
     else
     {
         size_t copy_bytes = (pos_wnd - pos_beh) * sizeof(ImGuiWindow*);
         memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
         g.Windows[pos_beh] = window;
+        UpdateWindowsDisplayOrder(pos_beh, pos_wnd + 1);
     }
 }
 
+// O(1): uses index maintained in window->DisplayOrder.
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    return g.Windows.index_from_ptr(g.Windows.find(window));
+    IM_UNUSED(g);
+    int order = window->DisplayOrder;
+    IM_ASSERT(order >= 0 && order < g.Windows.Size && g.Windows[order] == window);
+    return order;
+}
+
+// Refresh window->DisplayOrder for g.Windows[start_idx..end_idx-1] after they have been moved
+static void ImGui::UpdateWindowsDisplayOrder(int start_idx, int end_idx)
+{
+    ImGuiContext& g = *GImGui;
+    for (int n = start_idx; n < end_idx; n++)
+        if (g.Windows[n]->DisplayOrder != n)
+        {
+            g.Windows[n]->DisplayOrder = n;
+            g.WindowsHitGrid.Valid = false; // See UpdateWindowsHitGrid()
+        }
 }
 
 // Moving window to front of display and set focus (which happens to be back of our sorted list)
@@ -16205,6 +17019,11 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    Text("Free rects: %d (reused before packing new space)", atlas->Builder->PackFreeRects.Size);
+    Text("Glyphs: %" IM_PRIu64 " rendered, %d loaded", atlas->Builder->GlyphsRenderedCount, atlas->Builder->GlyphsLoadedCount);
+    Text("Evicted: %d glyphs, %d baked sizes (budget: %d bytes)", atlas->Builder->GlyphsEvictedCount, atlas->Builder->BakedEvictedCount, atlas->TexMaxMemorySize);
+    if (atlas->RunAsync != NULL)
+        Text("Async glyphs: %d queued, %d jobs in flight", atlas->Builder->AsyncRequests.Size, atlas->Builder->AsyncBatches.Size);
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16272,7 +17091,9 @@ void ImGui::DebugNodeTexture(ImTextureData* tex, int int_id, const ImFontAtlasRe
         PopStyleVar();
 
         char texid_desc[30];
-        Text("Status = %s (%d), Format = %s (%d), UseColors = %d", ImTextureDataGetStatusName(tex->Status), tex->Status, ImTextureDataGetFormatName(tex->Format), tex->Format, tex->UseColors);
+        Text("Status = %s (%d), Format = %s (%d), UseColors = %d, IsDistanceField = %d", ImTextureDataGetStatusName(tex->Status), tex->Status, ImTextureDataGetFormatName(tex->Format), tex->Format, tex->UseColors, tex->IsDistanceField);
+        if (tex->CompressedPixels != NULL)
+            Text("CompressedPixels: BC4, %d bytes", tex->GetCompressedSizeInBytes());
         Text("TexID = %s, BackendUserData = %p", FormatTextureRefForDebugDisplay(texid_desc, IM_ARRAYSIZE(texid_desc), tex->GetTexRef()), tex->BackendUserData);
         TreePop();
     }
@@ -16307,7 +17128,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    if (io.ConfigDrawDataMergeLists)
+        Text("%d draw commands (%d before merging draw lists)", io.MetricsRenderDrawCmds, g.DebugDrawCmdsCountBeforeMerge);
+    else
+        Text("%d draw commands", io.MetricsRenderDrawCmds);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
+    if (io.ConfigTextLayoutCache)
+        Text("Text layout cache: %d entries, %d hits, %d misses (last frame)", g.TextLayoutCache.Size, g.TextLayoutCacheHitsLastFrame, g.TextLayoutCacheMissesLastFrame);
+    if (io.ConfigWindowsHitGrid)
+        Text("Windows hit grid: %dx%d cells, %d entries", g.WindowsHitGrid.CellsX, g.WindowsHitGrid.CellsY, g.WindowsHitGrid.CellWindows.Size);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -16653,6 +17482,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
+        Text("Frame arena: %d bytes used, %d bytes high-water, %d bytes capacity", (int)g.FrameArena.UsedSize, (int)g.FrameArena.HighWaterSize, (int)g.FrameArena.capacity());
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
@@ -16946,7 +17776,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices%s, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->GetIdxCount(), draw_list->IdxBuffer32.Size > 0 ? " (32-bit)" : "", cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -16987,13 +17817,14 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
         const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
+        const ImU32* idx_buffer32 = (draw_list->IdxBuffer32.Size > 0) ? draw_list->IdxBuffer32.Data : NULL;
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
         float total_area = 0.0f;
         for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = vtx_buffer[idx_buffer32 ? idx_buffer32[idx_n] : idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -17013,10 +17844,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
-                    const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImDrawVert& v = vtx_buffer[idx_buffer32 ? idx_buffer32[idx_i] : idx_buffer ? idx_buffer[idx_i] : idx_i];
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, (float)v.pos.x, (float)v.pos.y, (float)v.uv.x, (float)v.uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -17046,11 +17877,12 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
     {
         ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
+        const ImU32* idx_buffer32 = (draw_list->IdxBuffer32.Size > 0) ? draw_list->IdxBuffer32.Data : NULL;
         ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer32 ? idx_buffer32[idx_n] : idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -17201,7 +18033,7 @@ void ImGui::DebugNodeFont(ImFont* font)
         if (baked->OwnerFont != font)
             continue;
         PushID(baked_n);
-        if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f }: %d glyphs%s", baked->Size, baked->RasterizerDensity, baked->Glyphs.Size, (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
+        if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f }: %d glyphs%s", baked->Size, baked->RasterizerDensity, baked->Glyphs.Size - baked->GlyphsFreeSlots.Size, (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
         {
             if (SmallButton("Load all"))
                 for (unsigned int base = 0; base <= IM_UNICODE_CODEPOINT_MAX; base++)
@@ -17298,7 +18130,7 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashIndex.size_in_bytes(), storage->IsUsingHashIndex() ? " (hash index)" : ""))
         return;
     for (const ImGuiStoragePair& p : storage->Data)
     {
@@ -17412,7 +18244,7 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
             (window->ChildFlags & ImGuiChildFlags_NavFlattened) ? "NavFlattened " : "");
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
-    BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d, SkipRefresh: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems, window->SkipRefresh);
     for (int layer = 0; layer < ImGuiNavLayer_COUNT; layer++)
     {
         ImRect r = window->NavRectRel[layer];
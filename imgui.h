@@ -173,12 +173,13 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
 struct ImFontAtlasRect;             // Output of ImFontAtlas::GetCustomRect() when using custom rectangles.
 struct ImFontBaked;                 // Baked data for a ImFont at a given size.
+struct ImFontBakedIndexPage;        // [Internal] Glyph lookup tables for a page of 256 code-points (see ImFontBaked::IndexPages[])
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
@@ -286,6 +287,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImFontAtlasParallelForFunc)(int jobs_count, void (*job_func)(int job_index, void* job_data), void* job_data, void* user_data); // Function signature for ImFontAtlas::ParallelFor
+typedef void    (*ImFontAtlasRunAsyncFunc)(void (*job_func)(void* job_data), void* job_data, void* user_data); // Function signature for ImFontAtlas::RunAsync
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // - This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -1718,6 +1721,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasIdx32      = 1 << 5,   // Backend Renderer supports ImDrawList::IdxBuffer32 (use GetIdxData()/GetIdxSize()/GetIdxCount()). With 16-bit ImDrawIdx, lists with 64K+ vertices are output with 32-bit indices instead of being split with ImDrawCmd::VtxOffset.
+    ImGuiBackendFlags_RendererHasTexturesBC4 = 1 << 6,  // Backend Renderer supports uploading ImTextureData::CompressedPixels (BC4 blocks). Font atlases using ImFontAtlasFlags_CompressedTexture only encode them when this is set.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2413,6 +2418,9 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawDataMergeLists;       // = false          // [EXPERIMENTAL] Merge draw lists in Render() so draw commands sharing texture and compatible clipping rectangles may be merged across windows. Reduces draw calls at the cost of copying vertices/indices on CPU. See io.MetricsRenderDrawCmds.
+    bool        ConfigTextLayoutCache;          // = false          // [EXPERIMENTAL] Cache layout of text (word-wrapping, glyph positions) across frames for CalcTextSize() and text rendering functions, keyed by text contents, font, size and wrap width. Speeds up large amounts of unchanging text (e.g. tables with many wrapped cells), at the cost of hashing text and of memory.
+    bool        ConfigWindowsHitGrid;           // = false          // [EXPERIMENTAL] Build a grid of window rectangles in EndFrame() when there are many active windows, so finding the hovered window only tests windows under the mouse. Grid is kept while windows don't move, resize, appear/disappear or change display order: useful with many windows in a mostly static layout.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2527,6 +2535,7 @@ struct ImGuiIO
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
+    int         MetricsRenderDrawCmds;              // Draw commands output during last call to Render() (~number of draw calls)
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
@@ -2759,6 +2768,8 @@ struct ImGuiStoragePair
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// Call SetUseHashIndex(true) (or '#define IMGUI_USE_STORAGE_HASH_INDEX' for all storages) for frequent insertions into large storages: pairs are then
+// kept in insertion order and indexed by an open-addressing hash table, for O(1) lookup and insertion at the cost of more memory.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2766,12 +2777,16 @@ struct ImGuiStoragePair
 struct ImGuiStorage
 {
     // [Internal]
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;               // Pairs, sorted by key (or in insertion order when using a hash index)
+    ImVector<int>                   HashIndex;          // When using a hash index: open-addressing table of indices into Data[] (-1 = empty slot). Size is a power of two.
+    ImS8                            HashIndexMode;      // 0: default (see IMGUI_USE_STORAGE_HASH_INDEX), 1: use hash index, -1: sorted. Use SetUseHashIndex().
+
+    ImGuiStorage()      { HashIndexMode = 0; }
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashIndex.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2791,7 +2806,15 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (when using a hash index, this rebuilds the index instead of sorting)
     IMGUI_API void      BuildSortByKey();
+    // Advanced: switch between sorted pairs and hash index. Existing pairs are kept.
+    IMGUI_API void      SetUseHashIndex(bool enabled);
+#ifdef IMGUI_USE_STORAGE_HASH_INDEX
+    bool                IsUsingHashIndex() const { return HashIndexMode >= 0; }
+#else
+    bool                IsUsingHashIndex() const { return HashIndexMode > 0; }
+#endif
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -3106,6 +3129,7 @@ struct ImGuiSelectionExternalStorage
 
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
+// - To use 16-bit indices + 32-bit indices only for large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32' and use ImDrawList::GetIdxData()/GetIdxSize()/GetIdxCount().
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibility with renderer backends)
@@ -3153,7 +3177,40 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT are mutually exclusive."
+#endif
+// Compact vertex layout (12 bytes instead of 20) enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h
+// - pos: 16-bit signed fixed point, stored value = position * IM_DRAWVERT_COMPACT_POS_SCALE (default 8 => 1/8th of a pixel, range -4096..+4095).
+// - uv: 16-bit signed normalized, stored value = uv * 32767 (range -1..+1).
+// Values are rounded and clamped on write. Reading a field returns a float/ImVec2 so most code can use ImDrawVert as usual.
+// Your renderer backend needs to read those as integers (e.g. GL_SHORT) and apply the scale, see imgui_impl_opengl3.cpp for an example.
+#ifndef IM_DRAWVERT_COMPACT_POS_SCALE
+#define IM_DRAWVERT_COMPACT_POS_SCALE       8
+#endif
+#define IM_DRAWVERT_COMPACT_UV_SCALE        32767
+template<int SCALE>
+struct ImDrawVertS16Field
+{
+    ImS16   Raw;
+    ImDrawVertS16Field& operator=(float v)  { v = v * (float)SCALE; v = (v < -32767.0f) ? -32767.0f : (v > 32767.0f) ? 32767.0f : v; Raw = (ImS16)(v < 0.0f ? v - 0.5f : v + 0.5f); return *this; }
+    operator float() const                  { return (float)Raw * (1.0f / (float)SCALE); }
+};
+template<int SCALE>
+struct ImDrawVertS16Vec2
+{
+    ImDrawVertS16Field<SCALE> x, y;
+    ImDrawVertS16Vec2& operator=(const ImVec2& v) { x = v.x; y = v.y; return *this; }
+    operator ImVec2() const                 { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertS16Vec2<IM_DRAWVERT_COMPACT_POS_SCALE>    pos;
+    ImDrawVertS16Vec2<IM_DRAWVERT_COMPACT_UV_SCALE>     uv;
+    ImU32                                               col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -3229,6 +3286,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowIdx32              = 1 << 4,  // Can promote indices to 32-bit (IdxBuffer32) instead of emitting 'VtxOffset > 0' for large meshes. Set when 'ImGuiBackendFlags_RendererHasIdx32' is enabled and ImDrawIdx is 16-bit.
 };
 
 // Draw command list
@@ -3246,6 +3304,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImU32>         IdxBuffer32;        // Index buffer promoted to 32-bit indices. Only set for lists with 64K+ vertices when ImDrawListFlags_AllowIdx32 is set, in which case IdxBuffer is emptied and all ImDrawCmd::VtxOffset are 0.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -3286,6 +3345,7 @@ struct ImDrawList
     IMGUI_API void  AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawFlags flags = 0, float thickness = 1.0f);   // a: upper-left, b: lower-right (== upper-left + size)
     IMGUI_API void  AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawFlags flags = 0);                     // a: upper-left, b: lower-right (== upper-left + size)
     IMGUI_API void  AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_max, ImU32 col_upr_left, ImU32 col_upr_right, ImU32 col_bot_right, ImU32 col_bot_left);
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min_max, const ImU32* cols, int rects_count);                                                     // Many AddRectFilled() without rounding. p_min_max: 2 points per rect (upper-left, lower-right), cols: 1 color per rect.
     IMGUI_API void  AddQuad(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness = 1.0f);
     IMGUI_API void  AddQuadFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col);
     IMGUI_API void  AddTriangle(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness = 1.0f);
@@ -3346,6 +3406,9 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer. For multi-threaded rendering, consider using `imgui_threaded_rendering` from https://github.com/ocornut/imgui_club instead.
+    inline const void* GetIdxData() const       { return IdxBuffer32.Size > 0 ? (const void*)IdxBuffer32.Data : (const void*)IdxBuffer.Data; }   // Index buffer to render: IdxBuffer32 when promoted to 32-bit indices, IdxBuffer otherwise.
+    inline int      GetIdxSize() const          { return IdxBuffer32.Size > 0 ? (int)sizeof(ImU32) : (int)sizeof(ImDrawIdx); }                   // Size of one index in GetIdxData(), in bytes.
+    inline int      GetIdxCount() const         { return IdxBuffer32.Size > 0 ? IdxBuffer32.Size : IdxBuffer.Size; }                             // Number of indices in GetIdxData().
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3386,6 +3449,7 @@ struct ImDrawList
     IMGUI_API void  _ClearFreeMemory();
     IMGUI_API void  _PopUnusedDrawCmd();
     IMGUI_API void  _TryMergeDrawCmds();
+    IMGUI_API void  _PromoteToIdx32();
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTexture();
     IMGUI_API void  _OnChangedVtxOffset();
@@ -3393,6 +3457,7 @@ struct ImDrawList
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API void  _PathRingN(const ImVec2& center, const ImVec2& radius, float rot, int num_segments);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -3402,7 +3467,7 @@ struct ImDrawData
 {
     bool                Valid;              // Only valid after Render() is called and before the next NewFrame() is called.
     int                 CmdListsCount;      // == CmdLists.Size. (OBSOLETE: exists for legacy reasons). Number of ImDrawList* to render.
-    int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
+    int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's GetIdxCount() (IdxBuffer.Size, or IdxBuffer32.Size when promoted to 32-bit indices)
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
@@ -3475,12 +3540,14 @@ struct ImTextureData
     int                 Height;                 // w    r   // Texture height
     int                 BytesPerPixel;          // w    r   // 4 or 1
     unsigned char*      Pixels;                 // w    r   // Pointer to buffer holding 'Width*Height' pixels and 'Width*Height*BytesPerPixels' bytes.
+    unsigned char*      CompressedPixels;       // w    r   // Optional: alpha channel of Pixels encoded as BC4 blocks (8 bytes per 4x4 block), encoded by EndFrame() for whole texture on creation, then for Updates[]. When set, Updates[] are aligned to 4x4 blocks. Backends may upload this instead of Pixels (e.g. GL_COMPRESSED_RED_RGTC1, VK_FORMAT_BC4_UNORM_BLOCK, DXGI_FORMAT_BC4_UNORM) and sample alpha from the red channel.
     ImTextureRect       UsedRect;               // w    r   // Bounding box encompassing all past and queued Updates[].
     ImTextureRect       UpdateRect;             // w    r   // Bounding box encompassing all queued Updates[].
     ImVector<ImTextureRect> Updates;            // w    r   // Array of individual updates.
     int                 UnusedFrames;           // w    r   // In order to facilitate handling Status==WantDestroy in some backend: this is a count successive frames where the texture was not used. Always >0 when Status==WantDestroy.
     unsigned short      RefCount;               // w    r   // Number of contexts using this texture. Used during backend shutdown.
     bool                UseColors;              // w    r   // Tell whether our texture data is known to use colors (rather than just white + alpha).
+    bool                IsDistanceField;        // w    r   // Alpha channel stores signed distance fields (ImFontAtlasFlags_DistanceField): 0.5 on glyph edges, 1.0 on solid pixels. Sample with e.g. smoothstep(0.5 - w, 0.5 + w, alpha).
     bool                WantDestroyNextFrame;   // rw   -   // [Internal] Queued to set ImTextureStatus_WantDestroy next frame. May still be used in the current frame.
 
     // Functions
@@ -3492,6 +3559,9 @@ struct ImTextureData
     void*               GetPixelsAt(int x, int y)   { IM_ASSERT(Pixels != NULL); return Pixels + (x + y * Width) * BytesPerPixel; }
     int                 GetSizeInBytes() const      { return Width * Height * BytesPerPixel; }
     int                 GetPitch() const            { return Width * BytesPerPixel; }
+    void*               GetCompressedPixelsAt(int x, int y) { IM_ASSERT(CompressedPixels != NULL && (x & 3) == 0 && (y & 3) == 0); return CompressedPixels + ((x >> 2) + (y >> 2) * (Width >> 2)) * 8; }
+    int                 GetCompressedSizeInBytes() const    { return (Width >> 2) * (Height >> 2) * 8; }
+    int                 GetCompressedPitch() const          { return (Width >> 2) * 8; } // Size of a row of 4x4 blocks
     ImTextureRef        GetTexRef()                 { ImTextureRef tex_ref; tex_ref._TexData = this; tex_ref._TexID = ImTextureID_Invalid; return tex_ref; }
     ImTextureID         GetTexID() const            { return TexID; }
 
@@ -3601,6 +3671,8 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DistanceField      = 1 << 3,   // [EXPERIMENTAL] Bake glyphs as signed distance fields, at a single size per font (DistanceFieldBakeSize) scaled to any requested size. Useful for e.g. zoomable canvases, typically in a secondary atlas. Requires renderer backend support (see ImTextureData::IsDistanceField), otherwise text will look blurry. Implies ImFontAtlasFlags_NoBakedLines. Glyphs are baked at rasterizer density 1 (RasterizerDensity is ignored, as fields are scaled). Only outline glyphs are supported: bitmap and colored glyphs (e.g. emojis) are treated as missing.
+    ImFontAtlasFlags_CompressedTexture  = 1 << 4,   // [EXPERIMENTAL] Also encode texture alpha channel as BC4 blocks (see ImTextureData::CompressedPixels), which renderer backends setting ImGuiBackendFlags_RendererHasTexturesBC4 upload instead of Pixels: 1/8th of the memory and upload bandwidth of RGBA32. Lossy. Colors are lost, so new textures are not compressed once colored glyphs have been loaded.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3718,7 +3790,15 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         TexMaxMemorySize;   // Texture memory budget in bytes. Default to 0 (unlimited). When growing the texture exceeded it, least recently used glyphs and baked sizes are evicted on next frame (and reloaded when needed again), then texture is shrunk back. Texture may still grow if everything was used during the frame. Requires ImGuiBackendFlags_RendererHasTextures.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    ImFontAtlasParallelForFunc  ParallelFor;        // [EXPERIMENTAL] Optional: call job_func(job_index, job_data) for each job_index in 0..jobs_count-1 on your worker threads, return when all completed. Used to rasterize glyphs in parallel when loading many at once (e.g. preloading glyph ranges for backends without ImGuiBackendFlags_RendererHasTextures).
+    void*                       ParallelForUserData;// Passed to ParallelFor().
+    int                         ParallelForJobsCount; // Number of jobs to split work into when calling ParallelFor() (typically your number of worker threads). Default to 0: load glyphs on calling thread.
+    ImFontAtlasRunAsyncFunc     RunAsync;           // [EXPERIMENTAL] Optional: call job_func(job_data) on a worker thread and return without waiting. When set, glyphs which are not loaded yet are rasterized in the background and rendered with the fallback glyph in the meantime (typically for 1-2 frames), instead of stalling the frame. Requires ImGuiBackendFlags_RendererHasTextures.
+    void*                       RunAsyncUserData;   // Passed to RunAsync().
+    float                       DistanceFieldBakeSize; // Size at which glyphs are baked with ImFontAtlasFlags_DistanceField. Default to 32.0f. Larger sizes preserve sharper corners at the cost of texture memory.
+    int                         DistanceFieldSpread;// Distance in pixels (at DistanceFieldBakeSize) encoded on each side of glyph edges with ImFontAtlasFlags_DistanceField. Default to 4.
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
@@ -3734,6 +3814,7 @@ struct ImFontAtlas
     ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
+    bool                        RendererHasTexturesBC4; // Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTexturesBC4) from owner context. Set it yourself if you call ImFontAtlasUpdateNewFrame() yourself.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format or conversion process.
     ImVec2                      TexUvScale;         // = (1.0f/TexData->TexWidth, 1.0f/TexData->TexHeight). May change as new texture gets created.
@@ -3774,15 +3855,17 @@ struct ImFontAtlas
 struct ImFontBaked
 {
     // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Dense, up to IM_FONTBAKED_INDEX_DENSE_SIZE. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // FindGlyph(FallbackChar)->AdvanceX
     float                       Size;               // 4     // in  // Height of characters/line, set during loading (doesn't change after loading)
     float                       RasterizerDensity;  // 4     // in  // Density this is baked at
 
     // [Internal] Members: Hot ~28/36 bytes (for RenderText loop)
-    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Dense, up to IM_FONTBAKED_INDEX_DENSE_SIZE. Index glyphs by Unicode code-point.
+    ImVector<ImFontBakedIndexPage*> IndexPages;     // 12-16 // out // Sparse. Same as IndexAdvanceX[] + IndexLookup[] for other code-points, by pages of 256 code-points allocated on demand (NULL when unused).
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
+    ImU16                       AsciiGlyphIndex[96];// 192   // out // Dense. Index of glyphs for printable ASCII 0x20..0x7F, with missing glyphs resolved to FallbackGlyphIndex. 0xFFFF when not looked up yet (for RenderText fast path).
 
     // [Internal] Members: Cold
     float                       Ascent, Descent;    // 4+4   // out // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize] (unscaled)
@@ -3791,6 +3874,8 @@ struct ImFontBaked
     unsigned int                LoadNoFallback:1;      // 0  //     // Disable loading fallback in lower-level calls.
     unsigned int                LoadNoRenderOnLayout:1;// 0  //     // Enable a two-steps mode where CalcTextSize() calls will load AdvanceX *without* rendering/packing glyphs. Only advantagous if you know that the glyph is unlikely to actually be rendered, otherwise it is slower because we'd do one query on the first CalcTextSize and one query on the first Draw.
     int                         LastUsedFrame;         // 4  //     // Record of that time this was bounds
+    ImVector<int>               GlyphsLastUsedFrame;// 12-16 //     // Parallel to Glyphs[]: frame when each glyph was last rendered. Only updated when ImFontAtlas::TexMaxMemorySize is set, for eviction.
+    ImVector<int>               GlyphsFreeSlots;    // 12-16 //     // Unused entries in Glyphs[] (evicted or replaced glyphs), reused by ImFontAtlasBakedAddFontGlyph().
     ImGuiID                     BakedId;            // 4     //     // Unique ID for this baked storage
     ImFont*                     OwnerFont;          // 4-8   // in  // Parent font
     void*                       FontLoaderDatas;    // 4-8   //     // Font loader opaque storage (per baked font * sources): single contiguous buffer allocated by imgui, passed to loader.
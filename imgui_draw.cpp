@@ -416,6 +416,58 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Unit circle rings are cached by segment count, so shapes using a handful of distinct segment counts don't need
+// to call ImCos()/ImSin() per point. Least recently used ring is evicted when all IM_DRAWLIST_RING_CACHE_SIZE slots are used.
+const ImVec2* ImDrawListSharedData::GetUnitRing(int segment_count)
+{
+    IM_ASSERT(segment_count > 0);
+    if (segment_count > IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX)
+        return NULL;
+    RingsUseCounter++;
+    ImDrawListUnitRing* ring = &Rings[0];
+    for (ImDrawListUnitRing& candidate : Rings)
+    {
+        if (candidate.SegmentCount == segment_count)
+        {
+            candidate.LastUsed = RingsUseCounter;
+            return candidate.Points.Data;
+        }
+        if (candidate.LastUsed < ring->LastUsed)
+            ring = &candidate;
+    }
+    ring->SegmentCount = segment_count;
+    ring->LastUsed = RingsUseCounter;
+    ring->Points.resize(segment_count);
+    for (int n = 0; n < segment_count; n++)
+    {
+        const float a = ((float)n * 2.0f * IM_PI) / (float)segment_count;
+        ring->Points[n] = ImVec2(ImCos(a), ImSin(a));
+    }
+    return ring->Points.Data;
+}
+
+// Per-thread instances own their TempBuffer[], DrawLists[] and Rings[], everything else is a copy of the main instance.
+void ImDrawListSharedData::CopySettingsFrom(const ImDrawListSharedData* src)
+{
+    TexUvWhitePixel = src->TexUvWhitePixel;
+    TexUvLines = src->TexUvLines;
+    FontAtlas = src->FontAtlas;
+    Font = src->Font;
+    FontSize = src->FontSize;
+    FontScale = src->FontScale;
+    CurveTessellationTol = src->CurveTessellationTol;
+    InitialFringeScale = src->InitialFringeScale;
+    InitialFlags = src->InitialFlags;
+    ClipRectFullscreen = src->ClipRectFullscreen;
+    Context = src->Context;
+    if (CircleSegmentMaxError != src->CircleSegmentMaxError)
+    {
+        CircleSegmentMaxError = src->CircleSegmentMaxError;
+        memcpy(CircleSegmentCounts, src->CircleSegmentCounts, sizeof(CircleSegmentCounts));
+        ArcFastRadiusCutoff = src->ArcFastRadiusCutoff;
+    }
+}
+
 ImDrawList::ImDrawList(ImDrawListSharedData* shared_data)
 {
     memset(this, 0, sizeof(*this));
@@ -450,6 +502,7 @@ void ImDrawList::_ResetForNewFrame()
 
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
+    IdxBuffer32.resize(0);
     VtxBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
@@ -469,6 +522,7 @@ void ImDrawList::_ClearFreeMemory()
 {
     CmdBuffer.clear();
     IdxBuffer.clear();
+    IdxBuffer32.clear();
     VtxBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
@@ -487,6 +541,7 @@ ImDrawList* ImDrawList::CloneOutput() const
     ImDrawList* dst = IM_NEW(ImDrawList(NULL));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
+    dst->IdxBuffer32 = IdxBuffer32;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
     return dst;
@@ -571,6 +626,42 @@ void ImDrawList::_TryMergeDrawCmds()
     }
 }
 
+// Convert a list which went past 64K vertices with 16-bit indices into 32-bit indices, removing the need for VtxOffset.
+// Commands which were only split because of VtxOffset are merged back together. Called when finalizing lists with ImDrawListFlags_AllowIdx32.
+// The 16-bit IdxBuffer is emptied but keeps its capacity, so neither buffer is reallocated on the next frames (only lists with 64K+ vertices pay for both).
+void ImDrawList::_PromoteToIdx32()
+{
+    bool has_vtx_offset = false;
+    for (const ImDrawCmd& cmd : CmdBuffer)
+        if (cmd.VtxOffset != 0) { has_vtx_offset = true; break; }
+    if (!has_vtx_offset)
+        return;
+
+    IdxBuffer32.resize(IdxBuffer.Size);
+    ImDrawCmd* dst_cmd = NULL;
+    for (ImDrawCmd* src_cmd = CmdBuffer.begin(); src_cmd < CmdBuffer.end(); src_cmd++)
+    {
+        if (src_cmd->UserCallback == NULL)
+        {
+            const ImDrawIdx* src_idx = IdxBuffer.Data + src_cmd->IdxOffset;
+            ImU32* dst_idx = IdxBuffer32.Data + src_cmd->IdxOffset;
+            for (unsigned int n = 0; n < src_cmd->ElemCount; n++)
+                dst_idx[n] = (ImU32)src_idx[n] + src_cmd->VtxOffset;
+        }
+        src_cmd->VtxOffset = 0;
+        if (dst_cmd != NULL && ImDrawCmd_HeaderCompare(dst_cmd, src_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(dst_cmd, src_cmd) && dst_cmd->UserCallback == NULL && src_cmd->UserCallback == NULL)
+        {
+            dst_cmd->ElemCount += src_cmd->ElemCount;
+            continue;
+        }
+        dst_cmd = (dst_cmd != NULL) ? dst_cmd + 1 : CmdBuffer.Data;
+        *dst_cmd = *src_cmd;
+    }
+    CmdBuffer.resize((int)(dst_cmd - CmdBuffer.Data) + 1);
+    IdxBuffer.resize(0);
+    _IdxWritePtr = NULL;
+}
+
 // Our scheme may appears a bit unusual, basically we want the most-common calls AddLine AddRect etc. to not have to perform any check so we always have a command ready in the stack.
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
 void ImDrawList::_OnChangedClipRect()
@@ -795,6 +886,123 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Compute normals of each segment of a polyline, stored at the index of the segment first point.
+// When the polyline is not closed, the last point reuses the normal of the last segment.
+// The SSE path processes 4 segments at a time and yields the same results as the scalar path: _mm_rsqrt_ps() uses the same approximation as _mm_rsqrt_ss() used by ImRsqrt().
+static void ImDrawList_ComputePolylineNormals(const ImVec2* points, const int points_count, bool closed, ImVec2* out_normals)
+{
+    const int count = closed ? points_count : points_count - 1;
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        const __m128 d01 = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 1].x), _mm_loadu_ps(&points[i1 + 0].x));
+        const __m128 d23 = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 3].x), _mm_loadu_ps(&points[i1 + 2].x));
+        __m128 dx = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 dy = _mm_shuffle_ps(d01, d23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 d2_mask = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_or_ps(_mm_and_ps(d2_mask, _mm_rsqrt_ps(d2)), _mm_andnot_ps(d2_mask, one)); // Same as IM_NORMALIZE2F_OVER_ZERO()
+        dx = _mm_mul_ps(dx, inv_len);
+        dy = _mm_mul_ps(dy, inv_len);
+        const __m128 nx = dy;
+        const __m128 ny = _mm_xor_ps(dx, sign_mask);
+        _mm_storeu_ps(&out_normals[i1 + 0].x, _mm_unpacklo_ps(nx, ny));
+        _mm_storeu_ps(&out_normals[i1 + 2].x, _mm_unpackhi_ps(nx, ny));
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+    if (!closed)
+        out_normals[points_count - 1] = out_normals[points_count - 2];
+}
+
+// Compute the direction in which to offset each point of a polyline, by averaging normals of adjacent segments.
+// When the polyline is not closed, the first point uses the normal of the first segment.
+static void ImDrawList_ComputePolylineOffsets(const ImVec2* normals, const int points_count, bool closed, ImVec2* out_offsets)
+{
+    int i2 = 1;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 min_d2 = _mm_set1_ps(0.000001f);
+    const __m128 max_inv_len2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i2 + 4 <= points_count; i2 += 4)
+    {
+        const __m128 s01 = _mm_add_ps(_mm_loadu_ps(&normals[i2 - 1].x), _mm_loadu_ps(&normals[i2 + 0].x));
+        const __m128 s23 = _mm_add_ps(_mm_loadu_ps(&normals[i2 + 1].x), _mm_loadu_ps(&normals[i2 + 2].x));
+        __m128 dm_x = _mm_mul_ps(_mm_shuffle_ps(s01, s23, _MM_SHUFFLE(2, 0, 2, 0)), half);
+        __m128 dm_y = _mm_mul_ps(_mm_shuffle_ps(s01, s23, _MM_SHUFFLE(3, 1, 3, 1)), half);
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+        const __m128 d2_mask = _mm_cmpgt_ps(d2, min_d2);
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_inv_len2);
+        const __m128 scale = _mm_or_ps(_mm_and_ps(d2_mask, inv_len2), _mm_andnot_ps(d2_mask, one)); // Same as IM_FIXNORMAL2F()
+        dm_x = _mm_mul_ps(dm_x, scale);
+        dm_y = _mm_mul_ps(dm_y, scale);
+        _mm_storeu_ps(&out_offsets[i2 + 0].x, _mm_unpacklo_ps(dm_x, dm_y));
+        _mm_storeu_ps(&out_offsets[i2 + 2].x, _mm_unpackhi_ps(dm_x, dm_y));
+    }
+#endif
+    const int count = closed ? points_count : points_count - 1; // The number of line segments
+    for (; i2 <= count; i2++)
+    {
+        const int i1 = i2 - 1;
+        const int i2_wrapped = (i2 == points_count) ? 0 : i2;
+        float dm_x = (normals[i1].x + normals[i2_wrapped].x) * 0.5f;
+        float dm_y = (normals[i1].y + normals[i2_wrapped].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_offsets[i2_wrapped].x = dm_x;
+        out_offsets[i2_wrapped].y = dm_y;
+    }
+    if (!closed)
+        out_offsets[0] = normals[0];
+}
+
+// Write vertices at 'points[i] + offsets[i] * scales[n]' for each point, with 'scales_count' vertices per point.
+// - This is the inner loop of anti-aliased AddPolyline(), with vertex colors and UV being provided per-vertex slot.
+// - The SSE path transforms 2 points at a time.
+static inline void ImDrawList_WritePolylineVertices(ImDrawVert* vtx_write, const ImVec2* points, const ImVec2* offsets, const int points_count, const float* scales, const ImVec2* uvs, const ImU32* cols, const int scales_count)
+{
+    int i = 0;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    for (; i + 2 <= points_count; i += 2)
+    {
+        const __m128 p = _mm_loadu_ps(&points[i].x);
+        const __m128 dm = _mm_loadu_ps(&offsets[i].x);
+        for (int n = 0; n < scales_count; n++)
+        {
+            const __m128 pos = _mm_add_ps(p, _mm_mul_ps(dm, _mm_set1_ps(scales[n])));
+            _mm_storel_pi((__m64*)(void*)&vtx_write[n].pos, pos);
+            _mm_storeh_pi((__m64*)(void*)&vtx_write[n + scales_count].pos, pos);
+            vtx_write[n].uv = vtx_write[n + scales_count].uv = uvs[n];
+            vtx_write[n].col = vtx_write[n + scales_count].col = cols[n];
+        }
+        vtx_write += scales_count * 2;
+    }
+#endif
+    for (; i < points_count; i++)
+    {
+        for (int n = 0; n < scales_count; n++)
+        {
+            vtx_write[n].pos.x = points[i].x + offsets[i].x * scales[n];
+            vtx_write[n].pos.y = points[i].y + offsets[i].y * scales[n];
+            vtx_write[n].uv = uvs[n];
+            vtx_write[n].col = cols[n];
+        }
+        vtx_write += scales_count;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -821,7 +1029,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         // Do we want to draw this line using a texture?
         // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
         // - If AA_SIZE is not 1.0f we cannot use the texture path.
-        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f) && (_Data->TexUvLines != NULL);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
         IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->OwnerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
@@ -831,23 +1039,14 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals at each line point, then after that there are <points_count> offsets (averaged normals) at each line point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_offsets = temp_normals + points_count;
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
-        if (!closed)
-            temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        // Calculate normals (tangents) for each line segment, then the direction in which to offset vertices for each line point
+        ImDrawList_ComputePolylineNormals(points, points_count, closed, temp_normals);
+        ImDrawList_ComputePolylineOffsets(temp_normals, points_count, closed, temp_offsets);
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -862,38 +1061,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being used as n+1 for the final segment
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertices for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -910,7 +1083,6 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
                     _IdxWritePtr += 12;
                 }
-
                 idx1 = idx2;
             }
 
@@ -927,76 +1099,32 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
                     tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
                 }*/
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
-                    _VtxWritePtr += 2;
-                }
+                const float scales[2] = { +half_draw_size, -half_draw_size };           // Left-side outer edge, Right-side outer edge
+                const ImVec2 uvs[2] = { ImVec2(tex_uvs.x, tex_uvs.y), ImVec2(tex_uvs.z, tex_uvs.w) };
+                const ImU32 cols[2] = { col, col };
+                ImDrawList_WritePolylineVertices(_VtxWritePtr, points, temp_offsets, points_count, scales, uvs, cols, 2);
             }
             else
             {
                 // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
-                    _VtxWritePtr += 3;
-                }
+                const float scales[3] = { 0.0f, +half_draw_size, -half_draw_size };     // Center of line, Left-side outer edge, Right-side outer edge
+                const ImVec2 uvs[3] = { opaque_uv, opaque_uv, opaque_uv };
+                const ImU32 cols[3] = { col, col_trans, col_trans };
+                ImDrawList_WritePolylineVertices(_VtxWritePtr, points, temp_offsets, points_count, scales, uvs, cols, 3);
             }
+            _VtxWritePtr += vtx_count;
         }
         else
         {
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being used as n+1 for the final segment
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
                 _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
@@ -1004,19 +1132,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
                 _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
                 _IdxWritePtr += 18;
-
                 idx1 = idx2;
             }
 
             // Add vertices
-            for (int i = 0; i < points_count; i++)
-            {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
-            }
+            const float half_outer_thickness = half_inner_thickness + AA_SIZE;
+            const float scales[4] = { +half_outer_thickness, +half_inner_thickness, -half_inner_thickness, -half_outer_thickness };
+            const ImVec2 uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+            const ImU32 cols[4] = { col_trans, col, col, col_trans };
+            ImDrawList_WritePolylineVertices(_VtxWritePtr, points, temp_offsets, points_count, scales, uvs, cols, 4);
+            _VtxWritePtr += vtx_count;
         }
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
@@ -1080,37 +1205,23 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, then the direction in which to offset vertices for each point (same as a closed AddPolyline())
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
+        ImVec2* temp_offsets = temp_normals + points_count;
+        ImDrawList_ComputePolylineNormals(points, points_count, true, temp_normals);
+        ImDrawList_ComputePolylineOffsets(temp_normals, points_count, true, temp_offsets);
+
+        // Add vertices
+        const float scales[2] = { -AA_SIZE * 0.5f, +AA_SIZE * 0.5f }; // Inner, Outer
+        const ImVec2 uvs[2] = { uv, uv };
+        const ImU32 cols[2] = { col, col_trans };
+        ImDrawList_WritePolylineVertices(_VtxWritePtr, points, temp_offsets, points_count, scales, uvs, cols, 2);
+        _VtxWritePtr += vtx_count;
+
+        // Add indexes for fringes
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
-
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
-
-            // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
-
-            // Add indexes for fringes
             _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
             _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
             _IdxWritePtr += 6;
@@ -1247,6 +1358,38 @@ void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, fl
     }
 }
 
+// Closed ring of 'num_segments' points (last point doesn't overlap first point), optionally rotated.
+// Same as PathEllipticalArcTo(center, radius, rot, 0.0f, a_max, num_segments - 1) with a_max = 2*PI*(num_segments-1)/num_segments, but using cached unit circle points.
+void ImDrawList::_PathRingN(const ImVec2& center, const ImVec2& radius, float rot, int num_segments)
+{
+    const ImVec2* ring = _Data->GetUnitRing(num_segments);
+    if (ring == NULL)
+    {
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        PathEllipticalArcTo(center, radius, rot, 0.0f, a_max, num_segments - 1);
+        return;
+    }
+
+    _Path.reserve(_Path.Size + num_segments);
+    ImVec2* out_ptr = _Path.Data + _Path.Size;
+    if (rot == 0.0f)
+    {
+        for (int n = 0; n < num_segments; n++)
+            out_ptr[n] = ImVec2(center.x + ring[n].x * radius.x, center.y + ring[n].y * radius.y);
+    }
+    else
+    {
+        const float cos_rot = ImCos(rot);
+        const float sin_rot = ImSin(rot);
+        for (int n = 0; n < num_segments; n++)
+        {
+            const ImVec2 point(ring[n].x * radius.x, ring[n].y * radius.y);
+            out_ptr[n] = ImVec2(center.x + (point.x * cos_rot) - (point.y * sin_rot), center.y + (point.x * sin_rot) + (point.y * cos_rot));
+        }
+    }
+    _Path.Size += num_segments;
+}
+
 // 0: East, 3: South, 6: West, 9: North, 12: East
 void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_12, int a_max_of_12)
 {
@@ -1513,6 +1656,70 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
     }
 }
 
+// Batch version of AddRectFilled() without rounding, for e.g. heatmaps or grids submitting many rectangles.
+// - 'p_min_max' holds two points per rectangle: upper-left then lower-right. 'cols' holds one color per rectangle.
+// - Vertices and indices are reserved once per chunk instead of once per rectangle. Fully transparent rectangles are skipped.
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min_max, const ImU32* cols, int rects_count)
+{
+    // Stay well under the 64k vertices limit of 16-bit indices for a single reservation.
+    const int RECTS_PER_CHUNK = 4096;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int chunk_start = 0, chunk_count = 0; chunk_start < rects_count; chunk_start += chunk_count)
+    {
+        chunk_count = ImMin(rects_count - chunk_start, RECTS_PER_CHUNK);
+        if (sizeof(ImDrawIdx) == 2 && (Flags & ImDrawListFlags_AllowVtxOffset))
+        {
+            // Fill up to the 64k vertices limit before PrimReserve() starts a new command, same as individual AddRectFilled() calls would.
+            const int rects_before_split = ((1 << 16) - 1 - (int)_VtxCurrentIdx) / 4;
+            if (rects_before_split > 0)
+                chunk_count = ImMin(chunk_count, rects_before_split);
+        }
+        PrimReserve(chunk_count * 6, chunk_count * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+        // Write position+uv of each vertex as a single 16-bytes store.
+        IM_STATIC_ASSERT(offsetof(ImDrawVert, pos) == 0 && offsetof(ImDrawVert, uv) == 8 && offsetof(ImDrawVert, col) == 16);
+        const __m128 uv4 = _mm_setr_ps(uv.x, uv.y, uv.x, uv.y);
+#endif
+        for (int n = chunk_start; n < chunk_start + chunk_count; n++)
+        {
+            const ImU32 col = cols[n];
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+            const __m128 r = _mm_loadu_ps(&p_min_max[n * 2].x); // min.x, min.y, max.x, max.y
+            _mm_storeu_ps(&vtx_write[0].pos.x, _mm_shuffle_ps(r, uv4, _MM_SHUFFLE(1, 0, 1, 0)));
+            _mm_storeu_ps(&vtx_write[1].pos.x, _mm_shuffle_ps(r, uv4, _MM_SHUFFLE(1, 0, 1, 2)));
+            _mm_storeu_ps(&vtx_write[2].pos.x, _mm_shuffle_ps(r, uv4, _MM_SHUFFLE(1, 0, 3, 2)));
+            _mm_storeu_ps(&vtx_write[3].pos.x, _mm_shuffle_ps(r, uv4, _MM_SHUFFLE(1, 0, 3, 0)));
+#else
+            const ImVec2& a = p_min_max[n * 2 + 0];
+            const ImVec2& c = p_min_max[n * 2 + 1];
+            vtx_write[0].pos.x = a.x; vtx_write[0].pos.y = a.y; vtx_write[0].uv = uv;
+            vtx_write[1].pos.x = c.x; vtx_write[1].pos.y = a.y; vtx_write[1].uv = uv;
+            vtx_write[2].pos.x = c.x; vtx_write[2].pos.y = c.y; vtx_write[2].uv = uv;
+            vtx_write[3].pos.x = a.x; vtx_write[3].pos.y = c.y; vtx_write[3].uv = uv;
+#endif
+            vtx_write[0].col = vtx_write[1].col = vtx_write[2].col = vtx_write[3].col = col;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+
+        // Release space reserved for skipped rectangles
+        const int written_count = (int)(idx - _VtxCurrentIdx) / 4;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        if (written_count < chunk_count)
+            PrimUnreserve((chunk_count - written_count) * 6, (chunk_count - written_count) * 4);
+    }
+}
+
 // p_min = upper-left, p_max = lower-right
 void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_max, ImU32 col_upr_left, ImU32 col_upr_right, ImU32 col_bot_right, ImU32 col_bot_left)
 {
@@ -1590,10 +1797,10 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
     {
         // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
         num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
-
-        // Because we are filling a closed shape we remove 1 from the count of segments/points
-        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-        PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+        if (radius - 0.5f < 0.5f)
+            _Path.push_back(center);
+        else
+            _PathRingN(center, ImVec2(radius - 0.5f, radius - 0.5f), 0.0f, num_segments);
     }
 
     PathStroke(col, ImDrawFlags_Closed, thickness);
@@ -1614,10 +1821,7 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     {
         // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
         num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
-
-        // Because we are filling a closed shape we remove 1 from the count of segments/points
-        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-        PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+        _PathRingN(center, ImVec2(radius, radius), 0.0f, num_segments);
     }
 
     PathFillConvex(col);
@@ -1629,9 +1833,10 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+    if (radius - 0.5f < 0.5f)
+        _Path.push_back(center);
+    else
+        _PathRingN(center, ImVec2(radius - 0.5f, radius - 0.5f), 0.0f, num_segments);
     PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
@@ -1641,9 +1846,10 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+    if (radius < 0.5f)
+        _Path.push_back(center);
+    else
+        _PathRingN(center, ImVec2(radius, radius), 0.0f, num_segments);
     PathFillConvex(col);
 }
 
@@ -1656,9 +1862,7 @@ void ImDrawList::AddEllipse(const ImVec2& center, const ImVec2& radius, ImU32 co
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = IM_PI * 2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathEllipticalArcTo(center, radius, rot, 0.0f, a_max, num_segments - 1);
+    _PathRingN(center, radius, rot, num_segments);
     PathStroke(col, true, thickness);
 }
 
@@ -1670,9 +1874,7 @@ void ImDrawList::AddEllipseFilled(const ImVec2& center, const ImVec2& radius, Im
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = IM_PI * 2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathEllipticalArcTo(center, radius, rot, 0.0f, a_max, num_segments - 1);
+    _PathRingN(center, radius, rot, num_segments);
     PathFillConvex(col);
 }
 
@@ -2292,6 +2494,10 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     if (sizeof(ImDrawIdx) == 2)
         IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
 
+    // Large meshes: convert to 32-bit indices instead of relying on VtxOffset
+    if ((draw_list->Flags & ImDrawListFlags_AllowIdx32) && sizeof(ImDrawIdx) == 2)
+        draw_list->_PromoteToIdx32();
+
     // Resolve callback data pointers
     if (draw_list->_CallbacksDataBuf.Size > 0)
         for (ImDrawCmd& cmd : draw_list->CmdBuffer)
@@ -2302,7 +2508,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     out_list->push_back(draw_list);
     draw_data->CmdListsCount++;
     draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
-    draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    draw_data->TotalIdxCount += draw_list->GetIdxCount();
 }
 
 void ImDrawData::AddDrawList(ImDrawList* draw_list)
@@ -2319,13 +2525,15 @@ void ImDrawData::DeIndexAllBuffers()
     TotalVtxCount = TotalIdxCount = 0;
     for (ImDrawList* draw_list : CmdLists)
     {
-        if (draw_list->IdxBuffer.empty())
+        const int idx_count = draw_list->GetIdxCount();
+        if (idx_count == 0)
             continue;
-        new_vtx_buffer.resize(draw_list->IdxBuffer.Size);
-        for (int j = 0; j < draw_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = draw_list->VtxBuffer[draw_list->IdxBuffer[j]];
+        new_vtx_buffer.resize(idx_count);
+        for (int j = 0; j < idx_count; j++)
+            new_vtx_buffer[j] = draw_list->VtxBuffer[draw_list->IdxBuffer32.Size > 0 ? draw_list->IdxBuffer32[j] : draw_list->IdxBuffer[j]];
         draw_list->VtxBuffer.swap(new_vtx_buffer);
         draw_list->IdxBuffer.resize(0);
+        draw_list->IdxBuffer32.resize(0);
         TotalVtxCount += draw_list->VtxBuffer.Size;
     }
 }
@@ -2423,6 +2631,9 @@ ImFontConfig::ImFontConfig()
 //-----------------------------------------------------------------------------
 // - ImTextureData::Create()
 // - ImTextureData::DestroyPixels()
+// - ImTextureDataCreateCompressedPixels()
+// - ImTextureDataEncodeCompressedBlocks()
+// - ImTextureDataUpdateCompressedPixels()
 //-----------------------------------------------------------------------------
 
 int ImTextureDataGetFormatBytesPerPixel(ImTextureFormat format)
@@ -2481,10 +2692,126 @@ void ImTextureData::DestroyPixels()
 {
     if (Pixels)
         IM_FREE(Pixels);
-    Pixels = NULL;
+    if (CompressedPixels)
+        IM_FREE(CompressedPixels);
+    Pixels = CompressedPixels = NULL;
     UseColors = false;
 }
 
+// Allocate a BC4 compressed copy of the alpha channel, see ImFontAtlasFlags_CompressedTexture. Size needs to be a multiple of 4.
+void ImTextureDataCreateCompressedPixels(ImTextureData* tex)
+{
+    IM_ASSERT(tex->Pixels != NULL && tex->CompressedPixels == NULL);
+    IM_ASSERT((tex->Width & 3) == 0 && (tex->Height & 3) == 0);
+    tex->CompressedPixels = (unsigned char*)IM_ALLOC(tex->GetCompressedSizeInBytes());
+    memset(tex->CompressedPixels, 0, tex->GetCompressedSizeInBytes()); // All-zero blocks decode as zero, matching cleared Pixels
+}
+
+// Encode 16 values into a BC4 block: two 8-bit endpoints followed by 16 3-bit palette indices.
+// Try both palette modes and keep the one with lowest error:
+// - endpoint0 > endpoint1: 8 values interpolated between min and max.
+// - endpoint0 <= endpoint1: 6 values interpolated between min and max of values other than 0 and 255, plus exact 0 and 255 (common in anti-aliased glyphs).
+static void ImTextureDataEncodeBC4Block(const unsigned char* values, unsigned char* out_block)
+{
+    int min_v = 255, max_v = 0, min_inner = 255, max_inner = 0;
+    for (int n = 0; n < 16; n++)
+    {
+        const int v = values[n];
+        min_v = ImMin(min_v, v);
+        max_v = ImMax(max_v, v);
+        if (v != 0 && v != 255)
+        {
+            min_inner = ImMin(min_inner, v);
+            max_inner = ImMax(max_inner, v);
+        }
+    }
+    if (min_inner > max_inner)
+        min_inner = max_inner = 0;
+
+    int palettes[2][8];
+    palettes[0][0] = max_v;
+    palettes[0][1] = min_v;
+    for (int i = 2; i < 8; i++)
+        palettes[0][i] = ((8 - i) * max_v + (i - 1) * min_v + 3) / 7;
+    palettes[1][0] = min_inner;
+    palettes[1][1] = max_inner;
+    for (int i = 2; i < 6; i++)
+        palettes[1][i] = ((6 - i) * min_inner + (i - 1) * max_inner + 2) / 5;
+    palettes[1][6] = 0;
+    palettes[1][7] = 255;
+
+    ImU64 best_bits = 0;
+    int best_error = INT_MAX;
+    int best_mode = 0;
+    for (int mode = (max_v > min_v) ? 0 : 1; mode < 2; mode++)
+    {
+        const int* palette = palettes[mode];
+        ImU64 bits = 0;
+        int error = 0;
+        for (int n = 0; n < 16; n++)
+        {
+            int best_i = 0, best_d = INT_MAX;
+            for (int i = 0; i < 8; i++)
+            {
+                const int d = ImAbs(palette[i] - (int)values[n]);
+                if (d < best_d)
+                    best_i = i, best_d = d;
+            }
+            bits |= (ImU64)best_i << (n * 3);
+            error += best_d * best_d;
+        }
+        if (error < best_error)
+            best_bits = bits, best_error = error, best_mode = mode;
+    }
+    out_block[0] = (unsigned char)palettes[best_mode][0];
+    out_block[1] = (unsigned char)palettes[best_mode][1];
+    for (int n = 0; n < 6; n++)
+        out_block[2 + n] = (unsigned char)(best_bits >> (n * 8));
+}
+
+// Encode blocks of CompressedPixels covering given rectangle of Pixels. Texture size needs to be a multiple of 4 (no partial edge blocks).
+void ImTextureDataEncodeCompressedBlocks(ImTextureData* tex, int x, int y, int w, int h)
+{
+    IM_ASSERT(tex->Pixels != NULL && tex->CompressedPixels != NULL);
+    IM_ASSERT((tex->Width & 3) == 0 && (tex->Height & 3) == 0);
+    const int x1 = ImMin((x + w + 3) & ~3, tex->Width);
+    const int y1 = ImMin((y + h + 3) & ~3, tex->Height);
+    unsigned char values[16];
+    for (int block_y = y & ~3; block_y < y1; block_y += 4)
+        for (int block_x = x & ~3; block_x < x1; block_x += 4)
+        {
+            for (int py = 0; py < 4; py++)
+            {
+                if (tex->Format == ImTextureFormat_RGBA32)
+                {
+                    const ImU32* src_p = (const ImU32*)tex->GetPixelsAt(block_x, block_y + py);
+                    for (int px = 0; px < 4; px++)
+                        values[py * 4 + px] = (unsigned char)((src_p[px] >> IM_COL32_A_SHIFT) & 0xFF);
+                }
+                else
+                {
+                    const ImU8* src_p = (const ImU8*)tex->GetPixelsAt(block_x, block_y + py);
+                    for (int px = 0; px < 4; px++)
+                        values[py * 4 + px] = src_p[px];
+                }
+            }
+            ImTextureDataEncodeBC4Block(values, (unsigned char*)tex->GetCompressedPixelsAt(block_x, block_y));
+        }
+}
+
+// Encode pending changes before rendering (called by ImGui::EndFrame()).
+// Done once per frame rather than when queuing uploads, since pixels are generally written after queuing.
+void ImTextureDataUpdateCompressedPixels(ImTextureData* tex)
+{
+    if (tex->CompressedPixels == NULL || tex->Pixels == NULL)
+        return;
+    if (tex->Status == ImTextureStatus_WantCreate)
+        ImTextureDataEncodeCompressedBlocks(tex, 0, 0, tex->Width, tex->Height); // Backends upload whole texture on creation
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+        for (const ImTextureRect& r : tex->Updates)
+            ImTextureDataEncodeCompressedBlocks(tex, r.x, r.y, r.w, r.h);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
 //-----------------------------------------------------------------------------
@@ -2541,6 +2868,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildDiscardFontBaked()
 // - ImFontAtlasBuildDiscardFontBakes()
 //-----------------------------------------------------------------------------
+// - ImFontAtlasSetReadOnlyForThreads()
 // - ImFontAtlasAddDrawListSharedData()
 // - ImFontAtlasRemoveDrawListSharedData()
 // - ImFontAtlasUpdateDrawListsTextures()
@@ -2561,12 +2889,16 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasPackAllocRectEntry()
 // - ImFontAtlasPackReuseRectEntry()
 // - ImFontAtlasPackDiscardRect()
+// - ImFontAtlasPackFlushDiscardedRects()
 // - ImFontAtlasPackAddRect()
 // - ImFontAtlasPackGetRect()
 //-----------------------------------------------------------------------------
-// - ImFontBaked_BuildGrowIndex()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
+// - ImFontAtlasBakedLoadGlyphs()
+// - ImFontAtlasBuildUpdateAsyncGlyphs(), ImFontAtlasBuildDiscardAsyncGlyphs()
+// - ImFontAtlasGlyphCacheSaveToMemory(), ImFontAtlasGlyphCacheLoadFromMemory()
+// - ImFontAtlasGlyphCacheSaveToDisk(), ImFontAtlasGlyphCacheLoadFromDisk()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasGetFontLoaderForStbTruetype()
@@ -2626,6 +2958,61 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 
 #define IM_FONTGLYPH_INDEX_UNUSED           ((ImU16)-1) // 0xFFFF
 #define IM_FONTGLYPH_INDEX_NOT_FOUND        ((ImU16)-2) // 0xFFFE
+#define IM_FONTGLYPH_INDEX_PENDING          ((ImU16)-3) // 0xFFFD // Queued for asynchronous loading (see ImFontAtlas::RunAsync)
+
+// Read ImFontBaked lookup tables: dense arrays first, then pages (see IM_FONTBAKED_INDEX_DENSE_SIZE)
+static inline ImU16 ImFontBaked_GetIndexLookup(const ImFontBaked* baked, unsigned int c)
+{
+    if (c < (unsigned int)baked->IndexLookup.Size) IM_LIKELY
+        return baked->IndexLookup.Data[c];
+    const unsigned int page_n = c >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    const ImFontBakedIndexPage* page = (page_n < (unsigned int)baked->IndexPages.Size) ? baked->IndexPages.Data[page_n] : NULL;
+    return page ? page->GlyphIndex[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)] : IM_FONTGLYPH_INDEX_UNUSED;
+}
+
+static inline float ImFontBaked_GetIndexAdvanceX(const ImFontBaked* baked, unsigned int c)
+{
+    if (c < (unsigned int)baked->IndexAdvanceX.Size) IM_LIKELY
+        return baked->IndexAdvanceX.Data[c];
+    const unsigned int page_n = c >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    const ImFontBakedIndexPage* page = (page_n < (unsigned int)baked->IndexPages.Size) ? baked->IndexPages.Data[page_n] : NULL;
+    return page ? page->AdvanceX[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)] : -1.0f;
+}
+
+// Write ImFontBaked lookup tables, growing dense arrays or allocating a page as needed
+static void ImFontBaked_BuildSetIndex(ImFontBaked* baked, unsigned int codepoint, ImU16 glyph_index, float advance_x)
+{
+    if (codepoint < IM_FONTBAKED_INDEX_DENSE_SIZE)
+    {
+        IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
+        if ((int)codepoint >= baked->IndexLookup.Size)
+        {
+            baked->IndexAdvanceX.resize(codepoint + 1, -1.0f);
+            baked->IndexLookup.resize(codepoint + 1, IM_FONTGLYPH_INDEX_UNUSED);
+        }
+        baked->IndexAdvanceX.Data[codepoint] = advance_x;
+        baked->IndexLookup.Data[codepoint] = glyph_index;
+        return;
+    }
+
+    const int page_n = (int)(codepoint >> IM_FONTBAKED_INDEX_PAGE_SHIFT);
+    if (page_n >= baked->IndexPages.Size)
+        baked->IndexPages.resize(page_n + 1, NULL);
+    ImFontBakedIndexPage* page = baked->IndexPages.Data[page_n];
+    if (page == NULL)
+    {
+        page = baked->IndexPages.Data[page_n] = (ImFontBakedIndexPage*)IM_ALLOC(sizeof(ImFontBakedIndexPage));
+        for (float& page_advance_x : page->AdvanceX)
+            page_advance_x = -1.0f;
+        memset(page->GlyphIndex, 0xFF, sizeof(page->GlyphIndex)); // IM_FONTGLYPH_INDEX_UNUSED
+    }
+    page->AdvanceX[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)] = advance_x;
+    page->GlyphIndex[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)] = glyph_index;
+}
+
+#ifndef IM_FONTATLAS_DEFRAG_PIXELS_PER_FRAME
+#define IM_FONTATLAS_DEFRAG_PIXELS_PER_FRAME (128 * 128) // Maximum surface of rectangles moved by ImFontAtlasUpdateNewFrame() when compacting texture in place.
+#endif
 
 ImFontAtlas::ImFontAtlas()
 {
@@ -2636,6 +3023,8 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    DistanceFieldBakeSize = 32.0f;
+    DistanceFieldSpread = 4;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2755,6 +3144,17 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     // Clear BakedCurrent cache, this is important because it ensure the uncached path gets taken once.
     // We also rely on ImFontBaked* pointers never crossing frames.
     ImFontAtlasBuilder* builder = atlas->Builder;
+
+    // Evict contents not used during last frame when growing texture exceeded memory budget (see ImFontAtlasTextureMakeSpace()).
+    // This needs to happen before updating FrameCount. Freed space is reused by packing below.
+    bool evicted = false;
+    if (builder->EvictPending)
+    {
+        builder->EvictPending = false;
+        if (atlas->TexMaxMemorySize > 0 && atlas->RendererHasTextures && !builder->LockDisableResize && !builder->ReadOnlyForThreads)
+            evicted = ImFontAtlasBuildEvictLRU(atlas, (int)(builder->RectsPackedSurface * 0.25f) - builder->RectsDiscardedSurface);
+    }
+
     builder->FrameCount = frame_count;
     for (ImFont* font : atlas->Fonts)
         font->LastBaked = NULL;
@@ -2833,6 +3233,31 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    // Compressed texture can't store colored glyphs, or backend doesn't support it anymore: replace with an uncompressed one
+    if (atlas->TexData != NULL && atlas->TexData->CompressedPixels != NULL && (atlas->TexPixelsUseColors || !atlas->RendererHasTexturesBC4) && atlas->RendererHasTextures && !builder->LockDisableResize)
+        ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
+
+    // Shrink texture back within memory budget after eviction
+    if (evicted && ImFontAtlasTextureGetMemorySize(atlas, atlas->TexData->Width, atlas->TexData->Height) > atlas->TexMaxMemorySize)
+    {
+        ImVec2i new_size = ImFontAtlasTextureGetSizeEstimate(atlas);
+        if (new_size.x * new_size.y < atlas->TexData->Width * atlas->TexData->Height)
+            ImFontAtlasTextureRepack(atlas, new_size.x, new_size.y);
+    }
+
+    // Make space discarded during last frame available for packing
+    ImFontAtlasPackFlushDiscardedRects(atlas);
+
+    // Incrementally compact texture after rectangles were discarded, so it doesn't need to be repacked or grown later.
+    // This moves and clears pixels in place: only done here, before any vertices of the new frame use them.
+    if (builder->PackDefragPending && atlas->RendererHasTextures && !builder->LockDisableResize && !builder->ReadOnlyForThreads)
+        if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f || !ImFontAtlasPackDefrag(atlas, IM_FONTATLAS_DEFRAG_PIXELS_PER_FRAME))
+            builder->PackDefragPending = false;
+
+    // Integrate glyphs loaded asynchronously, start loading glyphs requested during last frame
+    if (builder->AsyncBatches.Size > 0 || builder->AsyncRequests.Size > 0)
+        ImFontAtlasBuildUpdateAsyncGlyphs(atlas);
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -2874,8 +3299,8 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
 // Post-process hooks may eventually be added here.
 void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
 {
-    // Multiply operator (legacy)
-    if (data->FontSrc->RasterizerMultiply != 1.0f)
+    // Multiply operator (legacy). Not applicable to distance fields.
+    if (data->FontSrc->RasterizerMultiply != 1.0f && !(data->FontAtlas->Flags & ImFontAtlasFlags_DistanceField))
         ImFontAtlasTextureBlockPostProcessMultiply(data, data->FontSrc->RasterizerMultiply);
 }
 
@@ -2952,6 +3377,16 @@ void ImFontAtlasTextureBlockQueueUpload(ImFontAtlas* atlas, ImTextureData* tex,
     IM_ASSERT(tex->Status != ImTextureStatus_WantDestroy && tex->Status != ImTextureStatus_Destroyed);
     IM_ASSERT(x >= 0 && x <= 0xFFFF && y >= 0 && y <= 0xFFFF && w >= 0 && x + w <= 0x10000 && h >= 0 && y + h <= 0x10000);
     IM_UNUSED(atlas);
+    if (tex->CompressedPixels != NULL)
+    {
+        // Align to 4x4 blocks, so backends can upload compressed blocks
+        const int x1 = ImMin((x + w + 3) & ~3, tex->Width);
+        const int y1 = ImMin((y + h + 3) & ~3, tex->Height);
+        x &= ~3;
+        y &= ~3;
+        w = x1 - x;
+        h = y1 - y;
+    }
 
     ImTextureRect req = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
     int new_x1 = ImMax(tex->UpdateRect.w == 0 ? 0 : tex->UpdateRect.x + tex->UpdateRect.w, req.x + req.w);
@@ -3020,6 +3455,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
     // Lazily create builder on the first call to AddFont
     if (Builder == NULL)
         ImFontAtlasBuildInit(this);
+    ImFontAtlasBuildDiscardAsyncGlyphs(this, NULL, NULL); // Sources[] may be reallocated
 
     // Create new font
     ImFont* font;
@@ -3227,6 +3663,7 @@ static void ImFontAtlasBuildNotifySetFont(ImFontAtlas* atlas, ImFont* old_font,
 void ImFontAtlas::RemoveFont(ImFont* font)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
+    ImFontAtlasBuildDiscardAsyncGlyphs(this, NULL, NULL); // Sources[] of other fonts will be moved
     font->ClearOutputData();
 
     ImFontAtlasFontDestroyOutput(this, font);
@@ -3427,6 +3864,7 @@ void ImFontAtlasBuildSetupFontLoader(ImFontAtlas* atlas, const ImFontLoader* fon
 void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
 {
     atlas->Builder->PreloadedAllGlyphsRanges = true;
+    ImVector<ImWchar> codepoints;
     for (ImFont* font : atlas->Fonts)
     {
         ImFontBaked* baked = font->GetFontBaked(font->LegacySize);
@@ -3434,13 +3872,15 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
             baked->FindGlyph(font->FallbackChar);
         if (font->EllipsisChar != 0)
             baked->FindGlyph(font->EllipsisChar);
+        codepoints.resize(0);
         for (ImFontConfig* src : font->Sources)
         {
             const ImWchar* ranges = src->GlyphRanges ? src->GlyphRanges : atlas->GetGlyphRangesDefault();
             for (; ranges[0]; ranges += 2)
                 for (unsigned int c = ranges[0]; c <= ranges[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
-                    baked->FindGlyph((ImWchar)c);
+                    codepoints.push_back((ImWchar)c);
         }
+        ImFontAtlasBakedLoadGlyphs(atlas, baked, codepoints.Data, codepoints.Size);
     }
 }
 
@@ -3517,7 +3957,7 @@ static void ImFontAtlasBuildUpdateBasicTexData(ImFontAtlas* atlas)
 
 static void ImFontAtlasBuildUpdateLinesTexData(ImFontAtlas* atlas)
 {
-    if (atlas->Flags & ImFontAtlasFlags_NoBakedLines)
+    if (atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_DistanceField))
         return;
 
     // Pack and store identifier so we can refresh UV coordinates on texture resize.
@@ -3595,6 +4035,7 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 // Keep source/input FontData
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
+    ImFontAtlasBuildDiscardAsyncGlyphs(atlas, font, NULL);
     font->ClearOutputData();
     for (ImFontConfig* src : font->Sources)
     {
@@ -3769,8 +4210,11 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_ASSERT(font->FallbackChar != c && font->EllipsisChar != c); // Unsupported for simplicity
     IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
     IM_UNUSED(font);
-    baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
-    baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    ImFontBaked_BuildSetIndex(baked, c, IM_FONTGLYPH_INDEX_UNUSED, -1.0f); // Will be loaded again if needed
+    if (c >= 0x20 && c < 0x80)
+        baked->AsciiGlyphIndex[c - 0x20] = IM_FONTGLYPH_INDEX_UNUSED;
+    baked->GlyphsFreeSlots.push_back(baked->Glyphs.index_from_ptr(glyph));
+    atlas->Builder->BakedClearedCount++;
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
@@ -3837,6 +4281,7 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
     IMGUI_DEBUG_LOG_FONT("[font] Discard baked %.2f for \"%s\"\n", baked->Size, font->GetDebugName());
+    ImFontAtlasBuildDiscardAsyncGlyphs(atlas, NULL, baked);
 
     for (ImFontGlyph& glyph : baked->Glyphs)
         if (glyph.PackId != ImFontAtlasRectId_Invalid)
@@ -3857,6 +4302,7 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     }
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
+    builder->BakedClearedCount++;
     baked->ClearOutputData();
     baked->WantDestroy = true;
     font->LastBaked = NULL;
@@ -3892,6 +4338,103 @@ void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
     }
 }
 
+struct ImFontAtlasEvictCandidate
+{
+    int             LastUsedFrame;
+    ImFontBaked*    Baked;
+    int             GlyphIndex;     // -1 for the whole ImFontBaked
+};
+
+static int IMGUI_CDECL ImFontAtlasEvictCandidateComparer(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasEvictCandidate* a = (const ImFontAtlasEvictCandidate*)lhs;
+    const ImFontAtlasEvictCandidate* b = (const ImFontAtlasEvictCandidate*)rhs;
+    if (a->LastUsedFrame != b->LastUsedFrame)
+        return (a->LastUsedFrame < b->LastUsedFrame) ? -1 : +1; // Least recently used first
+    return (a->GlyphIndex < b->GlyphIndex) ? -1 : (a->GlyphIndex > b->GlyphIndex) ? +1 : 0; // Whole ImFontBaked first
+}
+
+// Discard least recently used ImFontBaked and glyphs until 'surface' pixels are freed. Return false if nothing could be discarded.
+// - Only considers contents which were not used during current frame (ImFontAtlasUpdateNewFrame() calls this before starting a new frame).
+// - ImFontBaked not used during current frame are discarded as a whole, other ones have their unused glyphs discarded one by one.
+// - Fallback and ellipsis glyphs, and fonts with ImFontFlags_LockBakedSizes are never evicted.
+// Glyph usage is only tracked when ImFontAtlas::TexMaxMemorySize is set (otherwise all glyphs are treated as unused since they were loaded).
+bool ImFontAtlasBuildEvictLRU(ImFontAtlas* atlas, int surface)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int frame_count = builder->FrameCount;
+    ImVector<ImFontAtlasEvictCandidate> candidates;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        ImFont* font = baked->OwnerFont;
+        if (baked->WantDestroy || (font->Flags & ImFontFlags_LockBakedSizes))
+            continue;
+        if (baked->LastUsedFrame < frame_count)
+        {
+            ImFontAtlasEvictCandidate candidate = { baked->LastUsedFrame, baked, -1 };
+            candidates.push_back(candidate);
+            continue;
+        }
+        for (int glyph_n = 0; glyph_n < baked->Glyphs.Size; glyph_n++)
+        {
+            const ImFontGlyph* glyph = &baked->Glyphs[glyph_n];
+            if (glyph->PackId == ImFontAtlasRectId_Invalid || baked->GlyphsLastUsedFrame[glyph_n] >= frame_count)
+                continue;
+            if (glyph_n == baked->FallbackGlyphIndex || glyph->Codepoint == font->FallbackChar || glyph->Codepoint == font->EllipsisChar)
+                continue;
+            ImFontAtlasEvictCandidate candidate = { baked->GlyphsLastUsedFrame[glyph_n], baked, glyph_n };
+            candidates.push_back(candidate);
+        }
+    }
+    if (candidates.Size == 0)
+        return false;
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImFontAtlasEvictCandidate), ImFontAtlasEvictCandidateComparer);
+
+    const int discarded_surface_target = builder->RectsDiscardedSurface + surface;
+    int evicted_glyphs = 0;
+    int evicted_bakes = 0;
+    for (const ImFontAtlasEvictCandidate& candidate : candidates)
+    {
+        if (builder->RectsDiscardedSurface >= discarded_surface_target)
+            break;
+        ImFontBaked* baked = candidate.Baked;
+        if (candidate.GlyphIndex == -1)
+        {
+            ImFontAtlasBakedDiscard(atlas, baked->OwnerFont, baked);
+            evicted_bakes++;
+        }
+        else
+        {
+            ImFontAtlasBakedDiscardFontGlyph(atlas, baked->OwnerFont, baked, &baked->Glyphs[candidate.GlyphIndex]);
+            evicted_glyphs++;
+        }
+    }
+    IMGUI_DEBUG_LOG_FONT("[font] Evicted %d glyphs and %d baked fonts to stay within budget of %d bytes.\n", evicted_glyphs, evicted_bakes, atlas->TexMaxMemorySize);
+    builder->GlyphsEvictedCount += evicted_glyphs;
+    builder->BakedEvictedCount += evicted_bakes;
+    return true;
+}
+
+// Used by multi-threaded ImDrawList recording. See ImGui::BeginDrawListsRecordingOnThreads().
+// While read-only, glyphs which are not loaded yet are rendered with the fallback glyph, and sizes which are not baked yet use closest match.
+void ImFontAtlasSetReadOnlyForThreads(ImFontAtlas* atlas, bool read_only)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(builder != NULL);
+    if (read_only)
+    {
+        // Fallback glyphs are normally lazily loaded: do it now.
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        {
+            ImFontBaked* baked = &builder->BakedPool[baked_n];
+            if (baked->FallbackGlyphIndex == -1 && !baked->WantDestroy)
+                ImFontAtlasBuildSetupFontBakedFallback(baked);
+        }
+    }
+    builder->ReadOnlyForThreads = read_only;
+}
+
 // Those functions are designed to facilitate changing the underlying structures for ImFontAtlas to store an array of ImDrawListSharedData*
 void ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data)
 {
@@ -3938,7 +4481,7 @@ void ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas)
         if (shared_data->FontAtlas == atlas)
         {
             shared_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
-            shared_data->TexUvLines = atlas->TexUvLines;
+            shared_data->TexUvLines = (atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_DistanceField)) ? NULL : atlas->TexUvLines; // NULL when current font comes from an atlas without baked lines
         }
 }
 
@@ -3984,6 +4527,9 @@ ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
     }
 
     new_tex->Create(atlas->TexDesiredFormat, w, h);
+    new_tex->IsDistanceField = (atlas->Flags & ImFontAtlasFlags_DistanceField) != 0;
+    if ((atlas->Flags & ImFontAtlasFlags_CompressedTexture) && atlas->RendererHasTexturesBC4 && !atlas->TexPixelsUseColors && (w & 3) == 0 && (h & 3) == 0)
+        ImTextureDataCreateCompressedPixels(new_tex);
     atlas->TexIsBuilt = false;
 
     ImFontAtlasBuildSetTexture(atlas, new_tex);
@@ -4003,15 +4549,97 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 }
 #endif
 
-void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
+// Read the packer's skyline: height of used space for each column of pixels.
+static void ImFontAtlasPackGetSkyline(ImFontAtlas* atlas, ImVector<int>* out_heights)
 {
-    ImFontAtlasBuilder* builder = atlas->Builder;
-    builder->LockDisableResize = true;
+    stbrp_context* ctx = (stbrp_context*)(void*)&atlas->Builder->PackContext;
+    out_heights->resize(ctx->width);
+    for (stbrp_node* node = ctx->active_head; node->next != NULL; node = node->next)
+        for (int x = node->x, x_end = ImMin((int)node->next->x, ctx->width); x < x_end; x++)
+            out_heights->Data[x] = node->y;
+}
 
-    ImTextureData* old_tex = atlas->TexData;
-    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, w, h);
-    new_tex->UseColors = old_tex->UseColors;
-    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize+repack %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
+// Reinitialize the packer for current texture size, with a given skyline (height of used space for each column of pixels).
+// Heights are rounded up to the packer's alignment, so the packer can never run out of nodes.
+static void ImFontAtlasPackSetSkyline(ImFontAtlas* atlas, const ImVector<int>& heights)
+{
+    ImTextureData* tex = atlas->TexData;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(heights.Size == tex->Width);
+    builder->PackNodes.resize(tex->Width / 2);
+    stbrp_context* ctx = (stbrp_context*)(void*)&builder->PackContext;
+    stbrp_init_target(ctx, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
+
+    stbrp_node* node = &ctx->extra[0];
+    for (int x = 0; x < ctx->width; x += ctx->align)
+    {
+        int y = 0;
+        for (int column = x, column_end = ImMin(x + ctx->align, ctx->width); column < column_end; column++)
+            y = ImMax(y, heights.Data[column]);
+        if (x == 0)
+        {
+            node->y = y;
+        }
+        else if (y != node->y)
+        {
+            IM_ASSERT(ctx->free_head != NULL);
+            node->next = ctx->free_head;
+            ctx->free_head = ctx->free_head->next;
+            node = node->next;
+            node->x = x;
+            node->y = y;
+        }
+    }
+    node->next = &ctx->extra[1];
+}
+
+// Update UV of all glyphs, after texture was resized or rectangles were moved
+static void ImFontAtlasBuildUpdateGlyphsUV(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid)
+            {
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+                glyph.U0 = (r->x) * atlas->TexUvScale.x;
+                glyph.V0 = (r->y) * atlas->TexUvScale.y;
+                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
+                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
+            }
+}
+
+// Grow texture so it follows roughly a square.
+// - Grow height before width, as width imply more packing nodes.
+// - Caller should be taking account of RectsDiscardedSurface and may not need to grow.
+static ImVec2i ImFontAtlasTextureGetGrowSize(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
+{
+    // FIXME-NEWATLAS-V2: What to do when reaching limits exposed by backend?
+    // FIXME-NEWATLAS-V2: Does ImFontAtlasFlags_NoPowerOfTwoHeight makes sense now? Allow 'lock' and 'compact' operations?
+    IM_ASSERT(ImIsPowerOfTwo(old_tex_w) && ImIsPowerOfTwo(old_tex_h));
+    IM_ASSERT(ImIsPowerOfTwo(atlas->TexMinWidth) && ImIsPowerOfTwo(atlas->TexMaxWidth) && ImIsPowerOfTwo(atlas->TexMinHeight) && ImIsPowerOfTwo(atlas->TexMaxHeight));
+    int new_tex_w = (old_tex_h <= old_tex_w) ? old_tex_w : old_tex_w * 2;
+    int new_tex_h = (old_tex_h <= old_tex_w) ? old_tex_h * 2 : old_tex_h;
+
+    // Handle minimum size first (for pathologically large packed rects)
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int pack_padding = atlas->TexGlyphPadding;
+    new_tex_w = ImMax(new_tex_w, ImUpperPowerOfTwo(builder->MaxRectSize.x + pack_padding));
+    new_tex_h = ImMax(new_tex_h, ImUpperPowerOfTwo(builder->MaxRectSize.y + pack_padding));
+    new_tex_w = ImClamp(new_tex_w, atlas->TexMinWidth, atlas->TexMaxWidth);
+    new_tex_h = ImClamp(new_tex_h, atlas->TexMinHeight, atlas->TexMaxHeight);
+    return ImVec2i(new_tex_w, new_tex_h);
+}
+
+void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->LockDisableResize = true;
+
+    ImTextureData* old_tex = atlas->TexData;
+    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, w, h);
+    new_tex->UseColors = old_tex->UseColors;
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize+repack %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
     //for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
     //    IMGUI_DEBUG_LOG_FONT("[font] - Baked %.2fpx, %d glyphs, want_destroy=%d\n", builder->BakedPool[baked_n].FontSize, builder->BakedPool[baked_n].Glyphs.Size, builder->BakedPool[baked_n].WantDestroy);
     //IMGUI_DEBUG_LOG_FONT("[font] - Old packed rects: %d, area %d px\n", builder->RectsPackedCount, builder->RectsPackedSurface);
@@ -4043,7 +4671,9 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
             builder->Rects.swap(old_rects);
             builder->RectsIndex = old_index;
             ImFontAtlasBuildSetTexture(atlas, old_tex);
-            ImFontAtlasTextureGrow(atlas, w, h); // Recurse
+            ImVec2i grow_size = ImFontAtlasTextureGetGrowSize(atlas, w, h);
+            if (grow_size.x != w || grow_size.y != h)
+                ImFontAtlasTextureRepack(atlas, grow_size.x, grow_size.y); // Recurse. Packer state is invalid: cannot grow in place.
             return;
         }
         IM_ASSERT(ImFontAtlasRectId_GetIndex(new_r_id) == builder->RectsIndex.index_from_ptr(&index_entry));
@@ -4055,16 +4685,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     builder->RectsDiscardedSurface = 0;
 
     // Patch glyphs UV
-    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
-        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
-            if (glyph.PackId != ImFontAtlasRectId_Invalid)
-            {
-                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
-                glyph.U0 = (r->x) * atlas->TexUvScale.x;
-                glyph.V0 = (r->y) * atlas->TexUvScale.y;
-                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
-                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
-            }
+    ImFontAtlasBuildUpdateGlyphsUV(atlas);
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
@@ -4075,36 +4696,52 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     //ImFontAtlasDebugWriteTexToDisk(new_tex, "After Pack");
 }
 
+// Grow texture in place: copy pixels and extend the packer's skyline, keeping all rectangles where they are.
+// Unlike a repack, discarded space is not reclaimed but stays available in PackFreeRects[].
 void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
-    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* old_tex = atlas->TexData;
     if (old_tex_w == -1)
-        old_tex_w = atlas->TexData->Width;
+        old_tex_w = old_tex->Width;
     if (old_tex_h == -1)
-        old_tex_h = atlas->TexData->Height;
+        old_tex_h = old_tex->Height;
 
-    // FIXME-NEWATLAS-V2: What to do when reaching limits exposed by backend?
-    // FIXME-NEWATLAS-V2: Does ImFontAtlasFlags_NoPowerOfTwoHeight makes sense now? Allow 'lock' and 'compact' operations?
-    IM_ASSERT(ImIsPowerOfTwo(old_tex_w) && ImIsPowerOfTwo(old_tex_h));
-    IM_ASSERT(ImIsPowerOfTwo(atlas->TexMinWidth) && ImIsPowerOfTwo(atlas->TexMaxWidth) && ImIsPowerOfTwo(atlas->TexMinHeight) && ImIsPowerOfTwo(atlas->TexMaxHeight));
+    ImVec2i new_tex_size = ImFontAtlasTextureGetGrowSize(atlas, old_tex_w, old_tex_h);
+    if (new_tex_size.x == old_tex_w && new_tex_size.y == old_tex_h)
+        return;
+    if (old_tex_w != old_tex->Width || old_tex_h != old_tex->Height || new_tex_size.x < old_tex->Width || new_tex_size.y < old_tex->Height || old_tex->Pixels == NULL)
+    {
+        ImFontAtlasTextureRepack(atlas, new_tex_size.x, new_tex_size.y);
+        return;
+    }
 
-    // Grow texture so it follows roughly a square.
-    // - Grow height before width, as width imply more packing nodes.
-    // - Caller should be taking account of RectsDiscardedSurface and may not need to grow.
-    int new_tex_w = (old_tex_h <= old_tex_w) ? old_tex_w : old_tex_w * 2;
-    int new_tex_h = (old_tex_h <= old_tex_w) ? old_tex_h * 2 : old_tex_h;
+    ImVector<int> skyline;
+    ImFontAtlasPackGetSkyline(atlas, &skyline);
+    skyline.resize(new_tex_size.x, 0);
 
-    // Handle minimum size first (for pathologically large packed rects)
-    const int pack_padding = atlas->TexGlyphPadding;
-    new_tex_w = ImMax(new_tex_w, ImUpperPowerOfTwo(builder->MaxRectSize.x + pack_padding));
-    new_tex_h = ImMax(new_tex_h, ImUpperPowerOfTwo(builder->MaxRectSize.y + pack_padding));
-    new_tex_w = ImClamp(new_tex_w, atlas->TexMinWidth, atlas->TexMaxWidth);
-    new_tex_h = ImClamp(new_tex_h, atlas->TexMinHeight, atlas->TexMaxHeight);
-    if (new_tex_w == old_tex_w && new_tex_h == old_tex_h)
-        return;
+    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, new_tex_size.x, new_tex_size.y);
+    new_tex->UseColors = old_tex->UseColors;
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: grow %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
+    ImFontAtlasTextureBlockCopy(old_tex, 0, 0, new_tex, 0, 0, old_tex->Width, old_tex->Height);
+    new_tex->UsedRect = old_tex->UsedRect;
+    ImFontAtlasPackSetSkyline(atlas, skyline);
 
-    ImFontAtlasTextureRepack(atlas, new_tex_w, new_tex_h);
+    // Patch UV (only their scale changed)
+    ImFontAtlasBuildUpdateGlyphsUV(atlas);
+    ImFontAtlasBuildUpdateLinesTexData(atlas);
+    ImFontAtlasBuildUpdateBasicTexData(atlas);
+    ImFontAtlasUpdateDrawListsSharedData(atlas);
+}
+
+// Texture memory as stored by the renderer backend, for a texture of given size in current format.
+// Backends upload CompressedPixels instead of Pixels when available (see ImFontAtlasFlags_CompressedTexture).
+int ImFontAtlasTextureGetMemorySize(ImFontAtlas* atlas, int w, int h)
+{
+    ImTextureData* tex = atlas->TexData;
+    if (tex->CompressedPixels != NULL && (w & 3) == 0 && (h & 3) == 0)
+        return (w >> 2) * (h >> 2) * 8;
+    return w * h * tex->BytesPerPixel;
 }
 
 void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
@@ -4114,10 +4751,28 @@ void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
     ImFontAtlasBuilder* builder = atlas->Builder;
     ImFontAtlasBuildDiscardBakes(atlas, 2);
 
+    // When growing would exceed memory budget: request eviction of least recently used contents by ImFontAtlasUpdateNewFrame().
+    // We may be in the middle of a frame: evicting now would repack into a new texture every time a glyph is loaded.
+    // Texture still grows below, it is shrunk back after eviction.
+    ImTextureData* old_tex = atlas->TexData;
+    if (atlas->TexMaxMemorySize > 0 && atlas->RendererHasTextures)
+    {
+        ImVec2i grow_size = ImFontAtlasTextureGetGrowSize(atlas, old_tex->Width, old_tex->Height);
+        if (ImFontAtlasTextureGetMemorySize(atlas, grow_size.x, grow_size.y) > atlas->TexMaxMemorySize)
+            builder->EvictPending = true;
+    }
+
     // Currently using a heuristic for repack without growing.
-    if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f)
-        ImFontAtlasTextureGrow(atlas);
-    else
+    // - Repack into a new texture when enough space was discarded. We may be in the middle of a frame: pixels of current texture
+    //   are left untouched as vertices may already use them (compacting in place is done by ImFontAtlasUpdateNewFrame()).
+    // - Otherwise grow in place, which keeps all rectangles where they are. Full repack when the texture cannot grow anymore.
+    if (builder->RectsDiscardedSurface >= builder->RectsPackedSurface * 0.20f)
+    {
+        ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
+        return;
+    }
+    ImFontAtlasTextureGrow(atlas);
+    if (atlas->TexData == old_tex && builder->RectsDiscardedSurface > 0)
         ImFontAtlasTextureRepack(atlas, atlas->TexData->Width, atlas->TexData->Height);
 }
 
@@ -4179,7 +4834,7 @@ void ImFontAtlasTextureCompact(ImFontAtlas* atlas)
     ImTextureData* old_tex = atlas->TexData;
     ImVec2i old_tex_size = ImVec2i(old_tex->Width, old_tex->Height);
     ImVec2i new_tex_size = ImFontAtlasTextureGetSizeEstimate(atlas);
-    if (builder->RectsDiscardedCount == 0 && new_tex_size.x == old_tex_size.x && new_tex_size.y == old_tex_size.y)
+    if (builder->RectsDiscardedCount == 0 && builder->RectsDiscardedSurface == 0 && new_tex_size.x == old_tex_size.x && new_tex_size.y == old_tex_size.y)
         return;
 
     ImFontAtlasTextureRepack(atlas, new_tex_size.x, new_tex_size.y);
@@ -4232,6 +4887,7 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 // Destroy builder and all cached glyphs. Do not destroy actual fonts.
 void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
 {
+    ImFontAtlasBuildDiscardAsyncGlyphs(atlas, NULL, NULL);
     for (ImFont* font : atlas->Fonts)
         ImFontAtlasFontDestroyOutput(atlas, font);
     if (atlas->Builder && atlas->FontLoader && atlas->FontLoader->LoaderShutdown)
@@ -4253,6 +4909,10 @@ void ImFontAtlasPackInit(ImFontAtlas * atlas)
     builder->PackNodes.resize(pack_node_count);
     IM_STATIC_ASSERT(sizeof(stbrp_context) <= sizeof(stbrp_context_opaque));
     stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, tex->Width, tex->Height, builder->PackNodes.Data, builder->PackNodes.Size);
+    builder->PackFreeRects.resize(0);
+    builder->PackFreeRectsPending.resize(0);
+    builder->PackDefragPending = false;
+    builder->RectsFreeSlots.resize(0);
     builder->RectsPackedSurface = builder->RectsPackedCount = 0;
     builder->MaxRectSize = ImVec2i(0, 0);
     builder->MaxRectBounds = ImVec2i(0, 0);
@@ -4292,7 +4952,56 @@ static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFon
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
-// This is expected to be called in batches and followed by a repack
+// Clear pixels of a rectangle which is not used anymore, so its space can be reused without bleeding
+static void ImFontAtlasPackClearPixels(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    ImTextureData* tex = atlas->TexData;
+    if (tex == NULL || tex->Pixels == NULL || tex->Status == ImTextureStatus_WantDestroy || tex->Status == ImTextureStatus_Destroyed)
+        return;
+    w = ImMin(w, tex->Width - x);
+    h = ImMin(h, tex->Height - y);
+    if (w <= 0 || h <= 0)
+        return;
+    ImFontAtlasTextureBlockFill(tex, x, y, w, h, IM_COL32_BLACK_TRANS);
+    ImFontAtlasTextureBlockQueueUpload(atlas, tex, x, y, w, h);
+}
+
+// Allocate space of given size (including padding) from PackFreeRects[], only considering free rectangles with y < max_y.
+// Pick the smallest fitting free rectangle and split the remaining L-shaped space in two, along the shorter leftover side.
+static bool ImFontAtlasPackAllocFreeRect(ImFontAtlasBuilder* builder, int w, int h, int max_y, ImTextureRect* out_r)
+{
+    int best_n = -1;
+    int best_surface = INT_MAX;
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
+    {
+        const ImTextureRect& f = builder->PackFreeRects.Data[n];
+        if (f.w < w || f.h < h || f.y >= max_y || f.w * f.h >= best_surface)
+            continue;
+        best_n = n;
+        best_surface = f.w * f.h;
+        if (best_surface == w * h)
+            break;
+    }
+    if (best_n == -1)
+        return false;
+
+    ImTextureRect f = builder->PackFreeRects[best_n];
+    builder->PackFreeRects.erase_unsorted(&builder->PackFreeRects[best_n]);
+    out_r->x = f.x;
+    out_r->y = f.y;
+    const int rem_w = f.w - w;
+    const int rem_h = f.h - h;
+    ImTextureRect right = { (unsigned short)(f.x + w), f.y, (unsigned short)rem_w, (unsigned short)(rem_w > rem_h ? f.h : h) };
+    ImTextureRect below = { f.x, (unsigned short)(f.y + h), (unsigned short)(rem_w > rem_h ? w : f.w), (unsigned short)rem_h };
+    if (right.w > 0 && right.h > 0)
+        builder->PackFreeRects.push_back(right);
+    if (below.w > 0 && below.h > 0)
+        builder->PackFreeRects.push_back(below);
+    return true;
+}
+
+// Space is made available to ImFontAtlasPackAddRect() and ImFontAtlasPackDefrag() on next frame, see ImFontAtlasPackFlushDiscardedRects().
+// This is generally called in batches, and we only compact when running out of space.
 void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
     IM_ASSERT(id != ImFontAtlasRectId_Invalid);
@@ -4312,12 +5021,29 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
         index_entry->Generation++; // Keep non-zero on overflow
 
     const int pack_padding = atlas->TexGlyphPadding;
+    ImTextureRect free_r = { rect->x, rect->y, (unsigned short)(rect->w + pack_padding), (unsigned short)(rect->h + pack_padding) };
+    builder->PackFreeRectsPending.push_back(free_r);
+    builder->PackDefragPending = true;
     builder->RectsIndexFreeListStart = index_idx;
+    builder->RectsFreeSlots.push_back((int)(rect - builder->Rects.Data));
     builder->RectsDiscardedCount++;
-    builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    builder->RectsDiscardedSurface += free_r.w * free_r.h;
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
+// Called by ImFontAtlasUpdateNewFrame(): clear pixels of rectangles discarded during last frame and make their space available.
+// Not done by ImFontAtlasPackDiscardRect(): vertices emitted earlier in the frame may still use those pixels.
+void ImFontAtlasPackFlushDiscardedRects(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (const ImTextureRect& free_r : builder->PackFreeRectsPending)
+    {
+        ImFontAtlasPackClearPixels(atlas, free_r.x, free_r.y, free_r.w, free_r.h);
+        builder->PackFreeRects.push_back(free_r);
+    }
+    builder->PackFreeRectsPending.resize(0);
+}
+
 // Important: Calling this may recreate a new texture and therefore change atlas->TexData
 // FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
 ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
@@ -4332,8 +5058,16 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
 
     // Pack
     ImTextureRect r = { 0, 0, (unsigned short)w, (unsigned short)h };
+    bool reused_free_rect = false;
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
+        // Try reusing discarded space
+        if (ImFontAtlasPackAllocFreeRect(builder, w + pack_padding, h + pack_padding, INT_MAX, &r))
+        {
+            reused_free_rect = true;
+            break;
+        }
+
         // Try packing
         stbrp_rect pack_r = {};
         pack_r.w = w + pack_padding;
@@ -4357,14 +5091,181 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
 
     builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
     builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
-    builder->RectsPackedCount++;
-    builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+    if (reused_free_rect)
+        builder->RectsDiscardedSurface -= (w + pack_padding) * (h + pack_padding);
+    else
+        builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
 
-    builder->Rects.push_back(r);
     if (overwrite_entry != NULL)
+    {
+        builder->RectsPackedCount++;
+        builder->Rects.push_back(r);
         return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
-    else
-        return ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+    }
+    if (builder->RectsFreeSlots.Size > 0)
+    {
+        // Reuse entry of a discarded rectangle
+        int rect_idx = builder->RectsFreeSlots.back();
+        builder->RectsFreeSlots.pop_back();
+        builder->RectsDiscardedCount--;
+        builder->Rects[rect_idx] = r;
+        return ImFontAtlasPackAllocRectEntry(atlas, rect_idx);
+    }
+    builder->RectsPackedCount++;
+    builder->Rects.push_back(r);
+    return ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+}
+
+static int IMGUI_CDECL ImFontAtlasPackDefragComparerByBottom(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs;
+    const ImU64 b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Move rectangles into free space above them. Return number of moved pixels.
+static int ImFontAtlasPackDefragMoveRects(ImFontAtlas* atlas, int max_pixels)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    const int pack_padding = atlas->TexGlyphPadding;
+
+    // Gather candidates, bottom-most first.
+    // Don't move white pixel/mouse cursors and lines data as their UV are cached in many places.
+    ImVector<ImU64> candidates;
+    for (int index_idx = 0; index_idx < builder->RectsIndex.Size; index_idx++)
+    {
+        ImFontAtlasRectEntry& index_entry = builder->RectsIndex[index_idx];
+        if (!index_entry.IsUsed)
+            continue;
+        const ImFontAtlasRectId id = ImFontAtlasRectId_Make(index_idx, index_entry.Generation);
+        if (id == builder->PackIdMouseCursors || id == builder->PackIdLinesTexData)
+            continue;
+        const ImTextureRect& r = builder->Rects[index_entry.TargetIndex];
+        candidates.push_back(((ImU64)(0x10000 - (r.y + r.h)) << 32) | (ImU64)index_entry.TargetIndex); // Sort key: bottom edge, descending
+    }
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImU64), ImFontAtlasPackDefragComparerByBottom);
+
+    int moved_pixels = 0;
+    for (ImU64 candidate : candidates)
+    {
+        if (max_pixels >= 0 && moved_pixels >= max_pixels)
+            break;
+        ImTextureRect* r = &builder->Rects[(int)(candidate & 0xFFFFFFFF)];
+        const int cell_w = r->w + pack_padding;
+        const int cell_h = r->h + pack_padding;
+        ImTextureRect dst;
+        if (!ImFontAtlasPackAllocFreeRect(builder, cell_w, cell_h, r->y, &dst))
+            continue;
+        ImFontAtlasTextureBlockCopy(tex, r->x, r->y, tex, dst.x, dst.y, r->w, r->h);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, dst.x, dst.y, r->w, r->h);
+        ImFontAtlasPackClearPixels(atlas, r->x, r->y, cell_w, cell_h);
+        ImTextureRect free_r = { r->x, r->y, (unsigned short)cell_w, (unsigned short)cell_h };
+        builder->PackFreeRects.push_back(free_r);
+        r->x = dst.x;
+        r->y = dst.y;
+        moved_pixels += cell_w * cell_h;
+    }
+    return moved_pixels;
+}
+
+// Give free space above the bottom-most used pixels of each column back to the packer.
+static bool ImFontAtlasPackDefragLowerSkyline(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    const int pack_padding = atlas->TexGlyphPadding;
+
+    // Bottom of used space for each column
+    ImVector<int> used_heights;
+    used_heights.resize(tex->Width, 0);
+    builder->MaxRectBounds = ImVec2i(0, 0);
+    for (const ImTextureRect& r : builder->Rects)
+    {
+        if (r.w == 0 && r.h == 0)
+            continue;
+        const int x1 = ImMin(r.x + r.w + pack_padding, tex->Width);
+        const int y1 = ImMin(r.y + r.h + pack_padding, tex->Height);
+        for (int x = r.x; x < x1; x++)
+            used_heights.Data[x] = ImMax(used_heights.Data[x], y1);
+        builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, x1);
+        builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, y1);
+    }
+
+    // Free rectangles entirely below used space can be given back, unless another free rectangle we keep is below them.
+    ImVector<bool> keep;
+    keep.resize(builder->PackFreeRects.Size);
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
+    {
+        const ImTextureRect& f = builder->PackFreeRects[n];
+        keep[n] = false;
+        for (int x = f.x; x < f.x + f.w && !keep[n]; x++)
+            keep[n] = (used_heights[x] > f.y);
+    }
+    ImVector<int> heights;
+    for (bool changed = true; changed; )
+    {
+        changed = false;
+        heights = used_heights;
+        for (int n = 0; n < builder->PackFreeRects.Size; n++)
+            if (keep[n])
+            {
+                const ImTextureRect& f = builder->PackFreeRects[n];
+                for (int x = f.x; x < f.x + f.w; x++)
+                    heights.Data[x] = ImMax(heights.Data[x], f.y + f.h);
+            }
+        for (int n = 0; n < builder->PackFreeRects.Size; n++)
+        {
+            const ImTextureRect& f = builder->PackFreeRects[n];
+            for (int x = f.x; x < f.x + f.w && !keep[n]; x++)
+                if (heights[x] > f.y)
+                    keep[n] = changed = true;
+        }
+    }
+
+    int dst_n = 0;
+    for (int n = 0; n < builder->PackFreeRects.Size; n++)
+    {
+        const ImTextureRect& f = builder->PackFreeRects[n];
+        if (keep[n])
+        {
+            builder->PackFreeRects[dst_n++] = f;
+            continue;
+        }
+        builder->RectsDiscardedSurface -= f.w * f.h;
+        builder->RectsPackedSurface -= f.w * f.h;
+    }
+    if (dst_n == builder->PackFreeRects.Size)
+        return false;
+    builder->PackFreeRects.resize(dst_n);
+    ImFontAtlasPackSetSkyline(atlas, heights);
+    return true;
+}
+
+// Compact texture in place, without creating a new texture:
+// - Move bottom-most rectangles into free space above them. Pixels of moved rectangles are copied and queued for upload.
+// - Give space freed at the bottom of the texture back to the packer (which can then fit larger rectangles).
+// A budget of moved pixels allows spreading the work over multiple frames (-1 = unlimited).
+bool ImFontAtlasPackDefrag(ImFontAtlas* atlas, int max_pixels)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    if (builder->PackFreeRects.Size == 0 || tex->Pixels == NULL || tex->Status == ImTextureStatus_WantDestroy)
+        return false;
+
+    int moved_pixels = 0;
+    for (int pass_moved_pixels = 1; pass_moved_pixels > 0 && (max_pixels < 0 || moved_pixels < max_pixels); )
+    {
+        pass_moved_pixels = ImFontAtlasPackDefragMoveRects(atlas, max_pixels < 0 ? -1 : max_pixels - moved_pixels);
+        moved_pixels += pass_moved_pixels;
+    }
+    if (moved_pixels > 0)
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: moved %d px of rectangles into %d free rectangles.\n", tex->UniqueID, moved_pixels, builder->PackFreeRects.Size);
+        ImFontAtlasBuildUpdateGlyphsUV(atlas);
+    }
+    bool lowered_skyline = ImFontAtlasPackDefragLowerSkyline(atlas);
+    return moved_pixels > 0 || lowered_skyline;
 }
 
 // Generally for non-user facing functions: assert on invalid ID.
@@ -4409,15 +5310,6 @@ static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar
     return true;
 }
 
-static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
-{
-    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
-    if (new_size <= baked->IndexLookup.Size)
-        return;
-    baked->IndexAdvanceX.resize(new_size, -1.0f);
-    baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
-}
-
 static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
 {
     IM_UNUSED(atlas);
@@ -4425,10 +5317,58 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
         *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
 }
 
+static void ImFontBaked_BuildMarkGlyphNotFound(ImFontBaked* baked, ImWchar codepoint)
+{
+    // Lazily load fallback glyph
+    if (baked->LoadNoFallback)
+        return;
+    if (baked->FallbackGlyphIndex == -1)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
+
+    // Mark index as not found, so we don't attempt the search twice
+    ImFontBaked_BuildSetIndex(baked, codepoint, IM_FONTGLYPH_INDEX_NOT_FOUND, baked->FallbackAdvanceX);
+}
+
+// Return false if a source doesn't support loading glyphs with jobs (ImFontLoader::FontBakedRasterizeGlyph() not implemented).
+static bool ImFontAtlasGlyphBatchCanUseJobs(ImFontAtlas* atlas, ImFont* font, size_t* out_loader_datas_size)
+{
+    size_t loader_datas_size = 0;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontBakedRasterizeGlyph == NULL)
+            return false;
+        loader_datas_size += loader->FontBakedThreadLoaderDataSize;
+    }
+    if (out_loader_datas_size)
+        *out_loader_datas_size = loader_datas_size;
+    return true;
+}
+
+// Queue glyph for asynchronous loading (see ImFontAtlas::RunAsync). Fallback glyph is used until it is loaded.
+static bool ImFontBaked_BuildQueueGlyphAsync(ImFontBaked* baked, ImWchar codepoint)
+{
+    ImFontAtlas* atlas = baked->OwnerFont->OwnerAtlas;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (atlas->RunAsync == NULL || !atlas->RendererHasTextures || builder->AsyncDisabled || baked->LoadNoFallback)
+        return false;
+    if (!ImFontAtlasGlyphBatchCanUseJobs(atlas, baked->OwnerFont, NULL))
+        return false;
+
+    if (baked->FallbackGlyphIndex == -1)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
+    ImFontBaked_BuildSetIndex(baked, codepoint, IM_FONTGLYPH_INDEX_PENDING, baked->FallbackAdvanceX);
+    ImFontAtlasGlyphAsyncRequest req = { baked->BakedId, codepoint };
+    builder->AsyncRequests.push_back(req);
+    return true;
+}
+
 static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
 {
     ImFont* font = baked->OwnerFont;
     ImFontAtlas* atlas = font->OwnerAtlas;
+    if (atlas->Builder->ReadOnlyForThreads)
+        return NULL; // Fallback glyphs have been loaded by ImFontAtlasSetReadOnlyForThreads()
     if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
     {
         // Lazily load fallback glyph
@@ -4450,6 +5390,14 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked))
             return glyph;
 
+    // Asynchronous loading
+    if (ImFontBaked_BuildQueueGlyphAsync(baked, src_codepoint))
+    {
+        if (only_load_advance_x != NULL)
+            *only_load_advance_x = baked->FallbackAdvanceX;
+        return NULL;
+    }
+
     // Call backend
     char* loader_user_data_p = (char*)baked->FontLoaderDatas;
     int src_n = 0;
@@ -4479,47 +5427,724 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
                 }
             }
         }
-        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
-        src_n++;
-    }
+        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+        src_n++;
+    }
+
+    ImFontBaked_BuildMarkGlyphNotFound(baked, codepoint);
+    return NULL;
+}
+
+static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
+{
+    if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
+    {
+        // First load AdvanceX value used by CalcTextSize() API then load the rest when loaded by drawing API.
+        float only_advance_x = 0.0f;
+        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
+        return glyph ? glyph->AdvanceX : only_advance_x;
+    }
+    else
+    {
+        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
+        return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
+    }
+}
+
+// Batch glyph loading: glyphs are rasterized by jobs which may run on worker threads (ImFontAtlas::ParallelFor),
+// then packed, copied into the texture and queued for upload on calling thread, in the order they were requested.
+// - Each job owns a pixel buffer and per-source loader data (e.g. a FT_Face for FreeType), so loaders don't share any scratch state.
+// - Sources whose loader doesn't implement ImFontLoader::FontBakedRasterizeGlyph() make us fallback to loading glyphs one by one.
+// - Asynchronous loading (ImFontAtlas::RunAsync) uses the same jobs, see ImFontAtlasBuildUpdateAsyncGlyphs() below.
+struct ImFontAtlasGlyphBatchItem
+{
+    ImWchar                 Codepoint;          // Requested codepoint
+    ImWchar                 LoadCodepoint;      // After remapping (see ImFont::AddRemapChar())
+    int                     SrcN;               // Index of source providing the glyph, -1 if not found
+    ImFontGlyph             Glyph;
+    ImFontGlyphBitmap       Bitmap;
+};
+
+struct ImFontAtlasGlyphBatchJob
+{
+    int                     ItemsBegin, ItemsEnd;
+    int                     LoaderDatasInitCount; // Number of sources for which FontBakedThreadInit() was called
+    ImVector<unsigned char> Pixels;             // Scratch buffer receiving rasterized pixels
+    ImVector<char>          LoaderDatas;        // FontBakedThreadLoaderDataSize bytes per source
+};
+
+struct ImFontAtlasGlyphBatch
+{
+    ImFontAtlas*                        Atlas;
+    ImFontBaked*                        Baked;
+    ImVector<ImFontAtlasGlyphBatchItem> Items;
+    ImVector<ImFontAtlasGlyphBatchJob*> Jobs;
+};
+
+// This may run on worker threads: only read from atlas/font/baked, write to our job and items.
+static void ImFontAtlasBakedLoadGlyphsJob(int job_index, void* job_data)
+{
+    ImFontAtlasGlyphBatch* batch = (ImFontAtlasGlyphBatch*)job_data;
+    ImFontAtlas* atlas = batch->Atlas;
+    ImFontBaked* baked = batch->Baked;
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlasGlyphBatchJob* job = batch->Jobs[job_index];
+    ImGui::DebugAllocHookBeginSkipThread(); // Debug allocation hooks are not thread-safe (see ImGui::MemAlloc())
+    for (int item_n = job->ItemsBegin; item_n < job->ItemsEnd; item_n++)
+    {
+        ImFontAtlasGlyphBatchItem* item = &batch->Items[item_n];
+        char* loader_data_for_baked_src = (char*)baked->FontLoaderDatas;
+        char* loader_data_for_thread = job->LoaderDatas.Data;
+        for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+        {
+            ImFontConfig* src = font->Sources[src_n];
+            const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+            if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, item->LoadCodepoint))
+                if (loader->FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, loader->FontBakedThreadLoaderDataSize ? loader_data_for_thread : NULL, item->LoadCodepoint, &item->Glyph, &item->Bitmap))
+                {
+                    item->SrcN = src_n;
+                    break;
+                }
+            loader_data_for_baked_src += loader->FontBakedSrcLoaderDataSize;
+            loader_data_for_thread += loader->FontBakedThreadLoaderDataSize;
+        }
+    }
+    ImGui::DebugAllocHookEndSkipThread();
+}
+
+// Create jobs and their per-source loader data. Return false if a loader failed to initialize its data.
+static bool ImFontAtlasGlyphBatchCreateJobs(ImFontAtlasGlyphBatch* batch, int jobs_count, size_t loader_datas_size)
+{
+    ImFontAtlas* atlas = batch->Atlas;
+    ImFontBaked* baked = batch->Baked;
+    bool init_ok = true;
+    for (int job_n = 0; job_n < jobs_count; job_n++)
+    {
+        ImFontAtlasGlyphBatchJob* job = IM_NEW(ImFontAtlasGlyphBatchJob)();
+        batch->Jobs.push_back(job);
+        job->ItemsBegin = (int)((ImS64)batch->Items.Size * job_n / jobs_count);
+        job->ItemsEnd = (int)((ImS64)batch->Items.Size * (job_n + 1) / jobs_count);
+        job->LoaderDatasInitCount = 0;
+        job->LoaderDatas.resize((int)loader_datas_size);
+        if (loader_datas_size > 0)
+            memset(job->LoaderDatas.Data, 0, loader_datas_size);
+        for (int item_n = job->ItemsBegin; item_n < job->ItemsEnd; item_n++)
+            batch->Items[item_n].Bitmap.Buffer = &job->Pixels;
+
+        char* loader_data_for_baked_src = (char*)baked->FontLoaderDatas;
+        char* loader_data_for_thread = job->LoaderDatas.Data;
+        for (ImFontConfig* src : baked->OwnerFont->Sources)
+        {
+            const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+            if (init_ok && loader->FontBakedThreadInit && !loader->FontBakedThreadInit(atlas, src, baked, loader_data_for_baked_src, loader_data_for_thread))
+                init_ok = false;
+            if (init_ok)
+                job->LoaderDatasInitCount++;
+            loader_data_for_baked_src += loader->FontBakedSrcLoaderDataSize;
+            loader_data_for_thread += loader->FontBakedThreadLoaderDataSize;
+        }
+    }
+    return init_ok;
+}
+
+static void ImFontAtlasGlyphBatchDestroyJobs(ImFontAtlasGlyphBatch* batch)
+{
+    for (ImFontAtlasGlyphBatchJob* job : batch->Jobs)
+    {
+        char* loader_data_for_thread = job->LoaderDatas.Data;
+        for (int src_n = 0; src_n < job->LoaderDatasInitCount; src_n++)
+        {
+            ImFontConfig* src = batch->Baked->OwnerFont->Sources[src_n];
+            const ImFontLoader* loader = src->FontLoader ? src->FontLoader : batch->Atlas->FontLoader;
+            if (loader->FontBakedThreadDestroy)
+                loader->FontBakedThreadDestroy(batch->Atlas, src, batch->Baked, loader_data_for_thread);
+            loader_data_for_thread += loader->FontBakedThreadLoaderDataSize;
+        }
+        IM_DELETE(job);
+    }
+    batch->Jobs.clear();
+}
+
+// Pack, copy pixels and queue texture upload for a rasterized glyph. Return false when running out of texture space.
+static bool ImFontAtlasGlyphBatchCommitItem(ImFontAtlas* atlas, ImFontBaked* baked, ImFontAtlasGlyphBatchItem* item)
+{
+    if (item->SrcN == -1)
+    {
+        ImFontBaked_BuildMarkGlyphNotFound(baked, item->LoadCodepoint);
+        if (item->Codepoint != item->LoadCodepoint)
+            ImFontBaked_BuildMarkGlyphNotFound(baked, item->Codepoint);
+        return true;
+    }
+    ImFontConfig* src = baked->OwnerFont->Sources[item->SrcN];
+    if (item->Glyph.Visible && !ImFontAtlasBakedPackFontGlyph(atlas, baked, src, &item->Glyph, &item->Bitmap))
+        return false;
+    item->Glyph.Codepoint = item->Codepoint;
+    item->Glyph.SourceIdx = item->SrcN;
+    ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &item->Glyph);
+    return true;
+}
+
+// Load many glyphs at once (e.g. a whole glyph range). Return number of glyphs added.
+// When ImFontAtlas::ParallelFor is set, rasterization is split into ImFontAtlas::ParallelForJobsCount jobs.
+int ImFontAtlasBakedLoadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, const ImWchar* codepoints, int codepoints_count)
+{
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(font->OwnerAtlas == atlas);
+    const int glyphs_count_before = builder->GlyphsLoadedCount;
+    if (builder->ReadOnlyForThreads || atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+        return 0;
+    baked->LastUsedFrame = builder->FrameCount; // Packing may evict least recently used bakes (see ImFontAtlasBuildEvictLRU())
+
+    // Gather codepoints not loaded yet
+    ImFontAtlasGlyphBatch batch;
+    batch.Atlas = atlas;
+    batch.Baked = baked;
+    size_t loader_datas_size = 0;
+    const bool can_use_jobs = (atlas->ParallelFor != NULL && atlas->ParallelForJobsCount > 1) && ImFontAtlasGlyphBatchCanUseJobs(atlas, font, &loader_datas_size);
+    const bool backup_async_disabled = builder->AsyncDisabled;
+    builder->AsyncDisabled = true; // Caller expects glyphs to be loaded on return
+    if (can_use_jobs)
+    {
+        int codepoint_max = 0;
+        for (int n = 0; n < codepoints_count; n++)
+            codepoint_max = ImMax(codepoint_max, (int)codepoints[n]);
+        ImBitVector requested;
+        requested.Create(codepoint_max + 1);
+        batch.Items.reserve(codepoints_count);
+        for (int n = 0; n < codepoints_count; n++)
+        {
+            const ImWchar c = codepoints[n];
+            if (ImFontBaked_GetIndexLookup(baked, c) != IM_FONTGLYPH_INDEX_UNUSED || requested.TestBit(c))
+                continue;
+            requested.SetBit(c);
+            ImWchar load_c = c;
+            ImFontAtlas_FontHookRemapCodepoint(atlas, font, &load_c);
+            if (load_c == font->EllipsisChar && font->EllipsisAutoBake)
+            {
+                baked->FindGlyph(c);
+                continue;
+            }
+            ImFontAtlasGlyphBatchItem item = { c, load_c, -1, ImFontGlyph(), ImFontGlyphBitmap(NULL) };
+            batch.Items.push_back(item);
+        }
+    }
+
+    // Not worth it or not supported: load one by one
+    const int jobs_count = ImMin(atlas->ParallelForJobsCount, batch.Items.Size / 16);
+    if (!can_use_jobs || jobs_count <= 1)
+    {
+        if (can_use_jobs)
+            for (ImFontAtlasGlyphBatchItem& item : batch.Items)
+                baked->FindGlyph(item.Codepoint);
+        else
+            for (int n = 0; n < codepoints_count; n++)
+                baked->FindGlyph(codepoints[n]);
+        builder->AsyncDisabled = backup_async_disabled;
+        return builder->GlyphsLoadedCount - glyphs_count_before;
+    }
+
+    // Rasterize
+    const bool init_ok = ImFontAtlasGlyphBatchCreateJobs(&batch, jobs_count, loader_datas_size);
+    if (init_ok)
+        atlas->ParallelFor(jobs_count, ImFontAtlasBakedLoadGlyphsJob, &batch, atlas->ParallelForUserData);
+
+    // Pack, copy pixels and queue texture uploads, in requested order
+    for (ImFontAtlasGlyphBatchItem& item : batch.Items)
+    {
+        if (init_ok)
+            ImFontAtlasGlyphBatchCommitItem(atlas, baked, &item);
+        else
+            baked->FindGlyph(item.Codepoint);
+    }
+
+    ImFontAtlasGlyphBatchDestroyJobs(&batch);
+    builder->AsyncDisabled = backup_async_disabled;
+    return builder->GlyphsLoadedCount - glyphs_count_before;
+}
+
+// Asynchronous glyph loading (ImFontAtlas::RunAsync)
+// - ImFontBaked_BuildLoadGlyph() marks missing glyphs as pending in IndexLookup[] and queues them. Fallback glyph is used meanwhile.
+// - ImFontAtlasUpdateNewFrame() integrates results of completed jobs, then starts one single-job batch per ImFontBaked for queued glyphs.
+//   A glyph requested during frame N is therefore typically displayed on frame N+2.
+// - The job uses a copy of ImFontBaked fields, as ImFontBaked instances may move in memory. Anything else it reads (sources,
+//   loader data) is only destroyed or reallocated after waiting for it, see ImFontAtlasBuildDiscardAsyncGlyphs().
+// - Jobs only reference the atlas, not any ImGuiContext: a shared atlas may outlive contexts. Destroying the atlas waits for them.
+struct ImFontAtlasGlyphAsyncBatch
+{
+    ImFontAtlasGlyphBatch   Batch;              // Batch.Baked points to BakedCopy
+    ImFontBaked             BakedCopy;          // Size, RasterizerDensity, Ascent etc. of the actual ImFontBaked. Glyphs and lookup tables are not copied.
+    volatile long           Done;
+
+    ImFontAtlasGlyphAsyncBatch() { Batch.Atlas = NULL; Batch.Baked = NULL; Done = 0; }
+};
+
+static void ImFontAtlasGlyphAsyncBatchJob(void* job_data)
+{
+    ImFontAtlasGlyphAsyncBatch* async_batch = (ImFontAtlasGlyphAsyncBatch*)job_data;
+    ImFontAtlasBakedLoadGlyphsJob(0, &async_batch->Batch);
+    ImAtomicStore(&async_batch->Done, 1);
+}
+
+static void ImFontAtlasGlyphAsyncBatchDestroy(ImFontAtlasGlyphAsyncBatch* async_batch)
+{
+    ImFontAtlasGlyphBatchDestroyJobs(&async_batch->Batch);
+    IM_DELETE(async_batch);
+}
+
+// Revert glyphs of a batch whose results are dropped to their unloaded state, so they are requested again when used.
+static void ImFontAtlasGlyphAsyncBatchClearPending(ImFontAtlas* atlas, ImFontAtlasGlyphAsyncBatch* async_batch)
+{
+    ImFontBaked* baked = (ImFontBaked*)atlas->Builder->BakedMap.GetVoidPtr(async_batch->BakedCopy.BakedId);
+    if (baked == NULL)
+        return;
+    for (ImFontAtlasGlyphBatchItem& item : async_batch->Batch.Items)
+        if (ImFontBaked_GetIndexLookup(baked, item.Codepoint) == IM_FONTGLYPH_INDEX_PENDING)
+            ImFontBaked_BuildSetIndex(baked, item.Codepoint, IM_FONTGLYPH_INDEX_UNUSED, -1.0f);
+}
+
+static void ImFontAtlasGlyphAsyncBatchStart(ImFontAtlas* atlas, ImFontBaked* baked, const ImFontAtlasGlyphAsyncRequest* requests, int requests_count)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFont* font = baked->OwnerFont;
+    ImFontAtlasGlyphAsyncBatch* async_batch = IM_NEW(ImFontAtlasGlyphAsyncBatch)();
+    ImFontBaked* baked_copy = &async_batch->BakedCopy;
+    baked_copy->Size = baked->Size;
+    baked_copy->RasterizerDensity = baked->RasterizerDensity;
+    baked_copy->Ascent = baked->Ascent;
+    baked_copy->Descent = baked->Descent;
+    baked_copy->BakedId = baked->BakedId;
+    baked_copy->OwnerFont = font;
+    baked_copy->FontLoaderDatas = baked->FontLoaderDatas; // Not owned
+    ImFontAtlasGlyphBatch* batch = &async_batch->Batch;
+    batch->Atlas = atlas;
+    batch->Baked = baked_copy;
+    for (int n = 0; n < requests_count; n++)
+    {
+        const ImWchar c = requests[n].Codepoint;
+        if (ImFontBaked_GetIndexLookup(baked, c) != IM_FONTGLYPH_INDEX_PENDING)
+            continue;
+        ImWchar load_c = c;
+        ImFontAtlas_FontHookRemapCodepoint(atlas, font, &load_c);
+        ImFontAtlasGlyphBatchItem item = { c, load_c, -1, ImFontGlyph(), ImFontGlyphBitmap(NULL) };
+        batch->Items.push_back(item);
+    }
+
+    size_t loader_datas_size = 0;
+    const bool init_ok = ImFontAtlasGlyphBatchCanUseJobs(atlas, font, &loader_datas_size) && ImFontAtlasGlyphBatchCreateJobs(batch, 1, loader_datas_size);
+    if (batch->Items.Size == 0 || !init_ok)
+    {
+        // Load synchronously if a loader failed to initialize its thread data
+        builder->AsyncDisabled = true;
+        for (ImFontAtlasGlyphBatchItem& item : batch->Items)
+        {
+            ImFontBaked_BuildSetIndex(baked, item.Codepoint, IM_FONTGLYPH_INDEX_UNUSED, -1.0f);
+            baked->FindGlyph(item.Codepoint);
+        }
+        builder->AsyncDisabled = false;
+        ImFontAtlasGlyphAsyncBatchDestroy(async_batch);
+        return;
+    }
+
+    builder->AsyncBatches.push_back(async_batch);
+    atlas->RunAsync(ImFontAtlasGlyphAsyncBatchJob, async_batch, atlas->RunAsyncUserData);
+}
+
+static int IMGUI_CDECL ImFontAtlasGlyphAsyncRequestComparerByBakedId(const void* lhs, const void* rhs)
+{
+    const ImGuiID a = ((const ImFontAtlasGlyphAsyncRequest*)lhs)->BakedId;
+    const ImGuiID b = ((const ImFontAtlasGlyphAsyncRequest*)rhs)->BakedId;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Called by ImFontAtlasUpdateNewFrame()
+void ImFontAtlasBuildUpdateAsyncGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+
+    // Integrate results of completed jobs
+    // - Remove them from AsyncBatches[] first: packing may discard bakes, which calls ImFontAtlasBuildDiscardAsyncGlyphs().
+    // - Drop results for bakes not used during last frame, as packing could discard them while we are adding glyphs.
+    ImVector<ImFontAtlasGlyphAsyncBatch*> completed_batches;
+    for (int batch_n = 0; batch_n < builder->AsyncBatches.Size; batch_n++)
+        if (ImAtomicLoad(&builder->AsyncBatches[batch_n]->Done) != 0)
+        {
+            completed_batches.push_back(builder->AsyncBatches[batch_n]);
+            builder->AsyncBatches.erase(builder->AsyncBatches.Data + batch_n);
+            batch_n--;
+        }
+    for (ImFontAtlasGlyphAsyncBatch* async_batch : completed_batches)
+    {
+        ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(async_batch->BakedCopy.BakedId);
+        if (baked != NULL && baked->LastUsedFrame + 2 > builder->FrameCount)
+        {
+            baked->LastUsedFrame = builder->FrameCount; // Packing may evict least recently used bakes (see ImFontAtlasBuildEvictLRU())
+            for (ImFontAtlasGlyphBatchItem& item : async_batch->Batch.Items)
+                if (ImFontBaked_GetIndexLookup(baked, item.Codepoint) == IM_FONTGLYPH_INDEX_PENDING) // May have been loaded synchronously meanwhile
+                    if (!ImFontAtlasGlyphBatchCommitItem(atlas, baked, &item))
+                        ImFontBaked_BuildMarkGlyphNotFound(baked, item.Codepoint);
+        }
+        else
+        {
+            ImFontAtlasGlyphAsyncBatchClearPending(atlas, async_batch);
+        }
+        builder->BakedClearedCount++; // Invalidate caches which used fallback glyphs (e.g. text layout cache)
+        ImFontAtlasGlyphAsyncBatchDestroy(async_batch);
+    }
+
+    // Start jobs for glyphs requested since last call, one per ImFontBaked
+    ImVector<ImFontAtlasGlyphAsyncRequest>& requests = builder->AsyncRequests;
+    if (requests.Size == 0)
+        return;
+    if (atlas->RunAsync == NULL || !atlas->RendererHasTextures)
+    {
+        // Asynchronous loading got disabled: glyphs will be requested again
+        for (ImFontAtlasGlyphAsyncRequest& req : requests)
+            if (ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(req.BakedId))
+                if (ImFontBaked_GetIndexLookup(baked, req.Codepoint) == IM_FONTGLYPH_INDEX_PENDING)
+                    ImFontBaked_BuildSetIndex(baked, req.Codepoint, IM_FONTGLYPH_INDEX_UNUSED, -1.0f);
+        builder->BakedClearedCount++;
+        requests.resize(0);
+        return;
+    }
+    ImQsort(requests.Data, (size_t)requests.Size, sizeof(ImFontAtlasGlyphAsyncRequest), ImFontAtlasGlyphAsyncRequestComparerByBakedId);
+    for (int req_n = 0; req_n < requests.Size; )
+    {
+        int req_end = req_n + 1;
+        while (req_end < requests.Size && requests[req_end].BakedId == requests[req_n].BakedId)
+            req_end++;
+        if (ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(requests[req_n].BakedId)) // May have been discarded
+            ImFontAtlasGlyphAsyncBatchStart(atlas, baked, requests.Data + req_n, req_end - req_n);
+        req_n = req_end;
+    }
+    requests.resize(0);
+}
+
+// Wait for jobs in flight and drop their results: called before destroying or reallocating data they may read.
+// Filter by font and/or baked when not NULL. Their pending glyphs will be requested again.
+void ImFontAtlasBuildDiscardAsyncGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL)
+        return;
+    for (int batch_n = 0; batch_n < builder->AsyncBatches.Size; batch_n++)
+    {
+        ImFontAtlasGlyphAsyncBatch* async_batch = builder->AsyncBatches[batch_n];
+        if ((font != NULL && async_batch->BakedCopy.OwnerFont != font) || (baked != NULL && async_batch->BakedCopy.BakedId != baked->BakedId))
+            continue;
+        while (ImAtomicLoad(&async_batch->Done) == 0)
+            ImThreadYield(); // We get here when destroying fonts and bakes, rarely with a job still running.
+        ImFontAtlasGlyphAsyncBatchClearPending(atlas, async_batch);
+        builder->BakedClearedCount++;
+        builder->AsyncBatches.erase(builder->AsyncBatches.Data + batch_n);
+        batch_n--;
+        ImFontAtlasGlyphAsyncBatchDestroy(async_batch);
+    }
+}
+
+// Glyph cache: save glyphs of all baked fonts, to load them on next run without rasterizing them again.
+// - Entries are keyed by a hash of font sources (font data, font loader and its flags, size, oversampling, offsets...), baked size and density.
+//   Entries which don't match any font of the atlas are ignored, so a cache file may be shared by different configurations.
+// - We store glyph metrics and pixels, read back from the atlas texture. Glyphs are packed again when loading, as the atlas texture
+//   is dynamic (sizes may be added/discarded, texture may grow or be compacted).
+// - Data is written in host byte order. Data written with a different IM_FONTATLAS_GLYPHCACHE_VERSION is ignored.
+#define IM_FONTATLAS_GLYPHCACHE_MAGIC       0x43474D49  // "IMGC"
+#define IM_FONTATLAS_GLYPHCACHE_VERSION     1
+
+static ImGuiID ImFontAtlasGlyphCacheGetFontKey(ImFontAtlas* atlas, ImFont* font)
+{
+    ImGuiID key = ImHashData(&font->Flags, sizeof(font->Flags), IM_FONTATLAS_GLYPHCACHE_VERSION);
+    key = ImHashData(&atlas->FontLoaderFlags, sizeof(atlas->FontLoaderFlags), key);
+    if (atlas->Flags & ImFontAtlasFlags_DistanceField)
+        key = ImHashData(&atlas->DistanceFieldSpread, sizeof(atlas->DistanceFieldSpread), key ^ ImFontAtlasFlags_DistanceField);
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        key = ImHashStr(loader->Name, 0, key);
+        key = ImHashData(src->FontData, (size_t)src->FontDataSize, key);
+        key = ImHashData(&src->FontNo, sizeof(src->FontNo), key);
+        key = ImHashData(&src->FontLoaderFlags, sizeof(src->FontLoaderFlags), key);
+        key = ImHashData(&src->SizePixels, sizeof(src->SizePixels), key);
+        key = ImHashData(&src->OversampleH, sizeof(src->OversampleH), key);
+        key = ImHashData(&src->OversampleV, sizeof(src->OversampleV), key);
+        key = ImHashData(&src->PixelSnapH, sizeof(src->PixelSnapH), key);
+        key = ImHashData(&src->PixelSnapV, sizeof(src->PixelSnapV), key);
+        key = ImHashData(&src->GlyphOffset, sizeof(src->GlyphOffset), key);
+        key = ImHashData(&src->GlyphMinAdvanceX, sizeof(src->GlyphMinAdvanceX), key);
+        key = ImHashData(&src->GlyphMaxAdvanceX, sizeof(src->GlyphMaxAdvanceX), key);
+        key = ImHashData(&src->GlyphExtraAdvanceX, sizeof(src->GlyphExtraAdvanceX), key);
+        key = ImHashData(&src->RasterizerMultiply, sizeof(src->RasterizerMultiply), key);
+        key = ImHashData(&src->RasterizerDensity, sizeof(src->RasterizerDensity), key);
+        key = ImHashData(&src->EllipsisChar, sizeof(src->EllipsisChar), key);
+        for (const ImWchar* p = src->GlyphExcludeRanges; p && p[0]; p++)
+            key = ImHashData(p, sizeof(*p), key);
+    }
+    return key;
+}
+
+// Pixels of glyphs which are not colored are white in a RGBA32 texture: only store their alpha channel.
+static ImTextureFormat ImFontAtlasGlyphCacheGetGlyphFormat(ImTextureFormat tex_format, bool colored)
+{
+    return (colored && tex_format == ImTextureFormat_RGBA32) ? ImTextureFormat_RGBA32 : ImTextureFormat_Alpha8;
+}
+
+static void ImFontAtlasGlyphCacheWrite(ImVector<unsigned char>* out_data, const void* data, int data_size)
+{
+    const int offset = out_data->Size;
+    out_data->resize(offset + data_size);
+    memcpy(out_data->Data + offset, data, (size_t)data_size);
+}
+
+static void ImFontAtlasGlyphCacheWriteU32(ImVector<unsigned char>* out_data, ImU32 v)    { ImFontAtlasGlyphCacheWrite(out_data, &v, 4); }
+static void ImFontAtlasGlyphCacheWriteFloat(ImVector<unsigned char>* out_data, float v) { ImFontAtlasGlyphCacheWrite(out_data, &v, 4); }
+
+void ImFontAtlasGlyphCacheSaveToMemory(ImFontAtlas* atlas, ImVector<unsigned char>* out_data)
+{
+    out_data->resize(0);
+    ImFontAtlasGlyphCacheWriteU32(out_data, IM_FONTATLAS_GLYPHCACHE_MAGIC);
+    ImFontAtlasGlyphCacheWriteU32(out_data, IM_FONTATLAS_GLYPHCACHE_VERSION);
+    const int baked_count_offset = out_data->Size;
+    ImFontAtlasGlyphCacheWriteU32(out_data, 0);
+
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || atlas->TexData == NULL)
+        return;
+    ImTextureData* tex = atlas->TexData;
+    ImGuiStorage font_keys; // FontId -> Key. Avoid hashing font data for each baked size.
+    ImU32 baked_count = 0;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        ImFont* font = baked->OwnerFont;
+        int* p_font_key = font_keys.GetIntRef(font->FontId, 0);
+        if (*p_font_key == 0)
+            *p_font_key = (int)ImFontAtlasGlyphCacheGetFontKey(atlas, font);
+
+        ImFontAtlasGlyphCacheWriteU32(out_data, (ImU32)*p_font_key);
+        ImFontAtlasGlyphCacheWriteFloat(out_data, baked->Size);
+        ImFontAtlasGlyphCacheWriteFloat(out_data, baked->RasterizerDensity);
+        ImFontAtlasGlyphCacheWriteU32(out_data, (ImU32)tex->Format);
+        ImBitVector glyphs_unused; // Skip unused entries (evicted or replaced glyphs)
+        glyphs_unused.Create(baked->Glyphs.Size);
+        for (int glyph_n : baked->GlyphsFreeSlots)
+            glyphs_unused.SetBit(glyph_n);
+        ImFontAtlasGlyphCacheWriteU32(out_data, (ImU32)(baked->Glyphs.Size - baked->GlyphsFreeSlots.Size));
+        for (int glyph_n = 0; glyph_n < baked->Glyphs.Size; glyph_n++)
+        {
+            if (glyphs_unused.TestBit(glyph_n))
+                continue;
+            const ImFontGlyph& glyph = baked->Glyphs[glyph_n];
+            ImTextureRect* r = (glyph.PackId != ImFontAtlasRectId_Invalid) ? ImFontAtlasPackGetRect(atlas, glyph.PackId) : NULL;
+            const int w = r ? r->w : 0;
+            const int h = r ? r->h : 0;
+            ImFontAtlasGlyphCacheWriteU32(out_data, glyph.Codepoint);
+            ImFontAtlasGlyphCacheWriteU32(out_data, glyph.Colored | (glyph.Visible << 1) | (glyph.SourceIdx << 2));
+            ImFontAtlasGlyphCacheWriteFloat(out_data, glyph.AdvanceX);
+            ImFontAtlasGlyphCacheWriteFloat(out_data, glyph.X0);
+            ImFontAtlasGlyphCacheWriteFloat(out_data, glyph.Y0);
+            ImFontAtlasGlyphCacheWriteFloat(out_data, glyph.X1);
+            ImFontAtlasGlyphCacheWriteFloat(out_data, glyph.Y1);
+            ImFontAtlasGlyphCacheWriteU32(out_data, (ImU32)w);
+            ImFontAtlasGlyphCacheWriteU32(out_data, (ImU32)h);
+            if (w == 0 || h == 0)
+                continue;
+            const ImTextureFormat glyph_format = ImFontAtlasGlyphCacheGetGlyphFormat(tex->Format, glyph.Colored);
+            const int line_size = w * ImTextureDataGetFormatBytesPerPixel(glyph_format);
+            const int offset = out_data->Size;
+            out_data->resize(offset + IM_MEMALIGN(line_size * h, 4));
+            ImFontAtlasTextureBlockConvert((const unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), out_data->Data + offset, glyph_format, line_size, w, h);
+        }
+
+        // Codepoints missing from the font, so we don't search them again
+        const int not_found_count_offset = out_data->Size;
+        ImU32 not_found_count = 0;
+        ImFontAtlasGlyphCacheWriteU32(out_data, 0);
+        const int codepoint_end = ImMax(baked->IndexLookup.Size, baked->IndexPages.Size << IM_FONTBAKED_INDEX_PAGE_SHIFT);
+        for (int c = 0; c < codepoint_end; c++)
+        {
+            if (c >= baked->IndexLookup.Size && baked->IndexPages[c >> IM_FONTBAKED_INDEX_PAGE_SHIFT] == NULL)
+            {
+                c |= IM_FONTBAKED_INDEX_PAGE_SIZE - 1; // Skip page
+                continue;
+            }
+            if (ImFontBaked_GetIndexLookup(baked, c) == IM_FONTGLYPH_INDEX_NOT_FOUND)
+            {
+                ImFontAtlasGlyphCacheWriteU32(out_data, (ImU32)c);
+                not_found_count++;
+            }
+        }
+        memcpy(out_data->Data + not_found_count_offset, &not_found_count, 4);
+        baked_count++;
+    }
+    memcpy(out_data->Data + baked_count_offset, &baked_count, 4);
+}
+
+struct ImFontAtlasGlyphCacheReader
+{
+    const unsigned char*    Data;
+    const unsigned char*    DataEnd;
+
+    bool                    Read(void* dst, size_t size)    { if ((size_t)(DataEnd - Data) < size) return false; memcpy(dst, Data, size); Data += size; return true; }
+    const unsigned char*    Skip(size_t size)               { if ((size_t)(DataEnd - Data) < size) return NULL; const unsigned char* p = Data; Data += size; return p; }
+};
+
+// Add glyphs stored in cache data to baked fonts of matching fonts (creating baked sizes as needed). Glyphs already loaded are left untouched.
+// Call after adding fonts, before using them. Return false on invalid data.
+bool ImFontAtlasGlyphCacheLoadFromMemory(ImFontAtlas* atlas, const void* data, size_t data_size)
+{
+    IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas!");
+    ImFontAtlasGlyphCacheReader reader = { (const unsigned char*)data, (const unsigned char*)data + data_size };
+    ImU32 magic = 0, version = 0, baked_count = 0;
+    if (!reader.Read(&magic, 4) || !reader.Read(&version, 4) || !reader.Read(&baked_count, 4))
+        return false;
+    if (magic != IM_FONTATLAS_GLYPHCACHE_MAGIC || version != IM_FONTATLAS_GLYPHCACHE_VERSION)
+        return false;
+
+    if (atlas->Builder == NULL)
+        ImFontAtlasBuildInit(atlas);
+    ImVector<ImGuiID> font_keys;
+    for (ImFont* font : atlas->Fonts)
+        font_keys.push_back(ImFontAtlasGlyphCacheGetFontKey(atlas, font));
+
+    for (ImU32 baked_n = 0; baked_n < baked_count; baked_n++)
+    {
+        ImU32 font_key, format, glyphs_count;
+        float size, density;
+        if (!reader.Read(&font_key, 4) || !reader.Read(&size, 4) || !reader.Read(&density, 4) || !reader.Read(&format, 4) || !reader.Read(&glyphs_count, 4))
+            return false;
+        if (format != ImTextureFormat_RGBA32 && format != ImTextureFormat_Alpha8)
+            return false;
+        const ImGuiID* p_font_key = font_keys.find(font_key);
+        ImFont* font = (p_font_key != font_keys.end()) ? atlas->Fonts[font_keys.index_from_ptr(p_font_key)] : NULL;
+        if (font && ((font->Flags & ImFontFlags_NoLoadGlyphs) || !(size > 0.0f && size <= IMGUI_FONT_SIZE_MAX && density > 0.0f)))
+            font = NULL;
+        ImFontBaked* baked = font ? ImFontAtlasBakedGetOrAdd(atlas, font, size, density) : NULL;
+        for (ImU32 glyph_n = 0; glyph_n < glyphs_count; glyph_n++)
+        {
+            ImU32 codepoint, flags, w, h;
+            ImFontGlyph glyph;
+            if (!reader.Read(&codepoint, 4) || !reader.Read(&flags, 4) || !reader.Read(&glyph.AdvanceX, 4) || !reader.Read(&glyph.X0, 4) || !reader.Read(&glyph.Y0, 4) || !reader.Read(&glyph.X1, 4) || !reader.Read(&glyph.Y1, 4) || !reader.Read(&w, 4) || !reader.Read(&h, 4))
+                return false;
+            if (codepoint > IM_UNICODE_CODEPOINT_MAX || w > (ImU32)atlas->TexMaxWidth || h > (ImU32)atlas->TexMaxHeight) // Glyph couldn't fit in texture: reject before computing sizes
+                return false;
+            const ImTextureFormat glyph_format = ImFontAtlasGlyphCacheGetGlyphFormat((ImTextureFormat)format, (flags & 1) != 0);
+            const int line_size = (int)w * ImTextureDataGetFormatBytesPerPixel(glyph_format);
+            const unsigned char* pixels = (w != 0 && h != 0) ? reader.Skip(IM_MEMALIGN((size_t)line_size * h, 4)) : NULL;
+            if (w != 0 && h != 0 && pixels == NULL)
+                return false;
+            if (baked == NULL || baked->IsGlyphLoaded((ImWchar)codepoint) || (int)(flags >> 2) >= font->Sources.Size)
+                continue;
+
+            glyph.Codepoint = codepoint;
+            glyph.Colored = (flags & 1);
+            glyph.Visible = (flags >> 1) & 1;
+            glyph.SourceIdx = (flags >> 2);
+            if (pixels != NULL)
+            {
+                ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, (int)w, (int)h);
+                if (pack_id == ImFontAtlasRectId_Invalid)
+                    continue;
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+                ImTextureData* tex = atlas->TexData;
+                ImFontAtlasTextureBlockConvert(pixels, glyph_format, line_size, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+                ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
+                glyph.PackId = pack_id;
+            }
+            ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph); // Metrics were already adjusted for source settings
+        }
 
-    // Lazily load fallback glyph
-    if (baked->LoadNoFallback)
-        return NULL;
-    if (baked->FallbackGlyphIndex == -1)
-        ImFontAtlasBuildSetupFontBakedFallback(baked);
+        ImU32 not_found_count;
+        if (!reader.Read(&not_found_count, 4))
+            return false;
+        for (ImU32 n = 0; n < not_found_count; n++)
+        {
+            ImU32 codepoint;
+            if (!reader.Read(&codepoint, 4) || codepoint > IM_UNICODE_CODEPOINT_MAX)
+                return false;
+            if (baked != NULL && ImFontBaked_GetIndexLookup(baked, codepoint) == IM_FONTGLYPH_INDEX_UNUSED)
+                ImFontBaked_BuildMarkGlyphNotFound(baked, (ImWchar)codepoint);
+        }
+    }
+    return true;
+}
 
-    // Mark index as not found, so we don't attempt the search twice
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
-    baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
-    return NULL;
+bool ImFontAtlasGlyphCacheSaveToDisk(ImFontAtlas* atlas, const char* filename)
+{
+    ImVector<unsigned char> data;
+    ImFontAtlasGlyphCacheSaveToMemory(atlas, &data);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size;
+    ImFileClose(f);
+    return ret;
 }
 
-static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
+bool ImFontAtlasGlyphCacheLoadFromDisk(ImFontAtlas* atlas, const char* filename)
 {
-    if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
-    {
-        // First load AdvanceX value used by CalcTextSize() API then load the rest when loaded by drawing API.
-        float only_advance_x = 0.0f;
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
-        return glyph ? glyph->AdvanceX : only_advance_x;
-    }
-    else
-    {
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
-        return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
-    }
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    bool ret = ImFontAtlasGlyphCacheLoadFromMemory(atlas, data, data_size);
+    IM_FREE(data);
+    return ret;
 }
 
 // The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
 IM_MSVC_RUNTIME_CHECKS_OFF
 static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint)
 {
+    const float advance_x = ImFontBaked_GetIndexAdvanceX(baked, codepoint); // Callers only checked dense table
+    if (advance_x >= 0.0f)
+        return advance_x;
     return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
 }
+
+// Slow path for the ASCII table lookup in RenderText(): load glyph and fill the table entry once resolved.
+static ImFontGlyph* BuildLoadGlyphFillAsciiIndex(ImFontBaked* baked, unsigned int codepoint)
+{
+    IM_ASSERT(codepoint >= 0x20 && codepoint < 0x80);
+    ImFontGlyph* glyph = baked->FindGlyph((ImWchar)codepoint);
+    // Glyphs marked as not found are cached as the fallback glyph. Not when no lookup was done (e.g. ImFontFlags_NoLoadGlyphs) or when loading is pending, or when sharing baked data with other threads.
+    const ImU16 glyph_index = ImFontBaked_GetIndexLookup(baked, codepoint);
+    if (glyph_index != IM_FONTGLYPH_INDEX_UNUSED && glyph_index != IM_FONTGLYPH_INDEX_PENDING && !baked->OwnerFont->OwnerAtlas->Builder->ReadOnlyForThreads)
+        baked->AsciiGlyphIndex[codepoint - 0x20] = (ImU16)baked->Glyphs.index_from_ptr(glyph);
+    return glyph;
+}
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
+// Return end of the run of printable ASCII characters (0x20..0x7F) starting at 'text'. Those need no UTF-8 decoding nor special handling.
+// Scan 16 bytes at a time with SSE2, 8 bytes at a time otherwise, then finish byte per byte.
+static inline const char* ImTextFindPrintableAsciiRunEnd(const char* text, const char* text_end)
+{
+#ifdef IMGUI_ENABLE_SSE
+    const __m128i space = _mm_set1_epi8(0x20);
+    while (text_end - text >= 16)
+    {
+        // Signed comparison: bytes >= 0x80 are negative, so this catches both control characters and non-ASCII bytes.
+        if (_mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)text), space)) != 0)
+            break;
+        text += 16;
+    }
+#else
+    while (text_end - text >= 8)
+    {
+        // Any byte < 0x20 borrows into its high bit, any byte >= 0x80 already has it set.
+        ImU64 v;
+        memcpy(&v, text, 8);
+        if (((v - 0x2020202020202020ULL) | v) & 0x8080808080808080ULL)
+            break;
+        text += 8;
+    }
+#endif
+    while (text < text_end && (unsigned char)(*text - 0x20) < 0x60)
+        text++;
+    return text;
+}
+
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
 {
@@ -4638,9 +6263,9 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
-static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+// Rasterize into 'out_bitmap' without touching the atlas: may be called from multiple threads (stbtt_fontinfo is only read from).
+static bool ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, void*, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontGlyphBitmap* out_bitmap)
 {
-    // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data);
     int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
@@ -4650,6 +6275,9 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     // Fonts unit to pixels
     int oversample_h, oversample_v;
     ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+    const bool distance_field = (atlas->Flags & ImFontAtlasFlags_DistanceField) != 0;
+    if (distance_field)
+        oversample_h = oversample_v = 1;
     const float scale_for_layout = bd_font_data->ScaleFactor * baked->Size;
     const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
     const float scale_for_raster_x = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_h;
@@ -4661,46 +6289,42 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
     stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
 
-    // Load metrics only mode
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance * scale_for_layout;
-        return true;
-    }
-
     // Prepare glyph
     out_glyph->Codepoint = codepoint;
     out_glyph->AdvanceX = advance * scale_for_layout;
 
-    // Pack and retrieve position inside texture atlas
+    // Render into bitmap. Packing and retrieving position inside texture atlas is done by caller.
     // (generally based on stbtt_PackFontRangesRenderIntoRects)
     const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
-        const int w = (x1 - x0 + oversample_h - 1);
-        const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
+        int w, h;
+        float sub_x = 0.0f, sub_y = 0.0f;
+        if (distance_field)
         {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
+            // Render signed distance field, with 'DistanceFieldSpread' pixels of padding around the glyph and 128 on edges.
+            IM_ASSERT(atlas->DistanceFieldSpread > 0);
+            const int spread = atlas->DistanceFieldSpread;
+            unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&bd_font_data->FontInfo, scale_for_raster_x, glyph_index, spread, 128, 127.0f / spread, &w, &h, &x0, &y0);
+            if (sdf_pixels == NULL)
+                return true;
+            memcpy(out_bitmap->AllocPixels(w, h, ImTextureFormat_Alpha8), sdf_pixels, (size_t)(w * h));
+            stbtt_FreeSDF(sdf_pixels, NULL);
         }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+        else
+        {
+            w = (x1 - x0 + oversample_h - 1);
+            h = (y1 - y0 + oversample_v - 1);
 
-        // Render
-        stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
+            // Render
+            stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
+            unsigned char* bitmap_pixels = out_bitmap->AllocPixels(w, h, ImTextureFormat_Alpha8);
 
-        // Render with oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
-        float sub_x, sub_y;
-        stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+            // Render with oversampling
+            // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+            stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
+                scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        }
 
         const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -4716,20 +6340,46 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         float recip_v = 1.0f / (oversample_v * rasterizer_density);
 
         // Register glyph
-        // r->x r->y are coordinates inside texture (in pixels)
         // glyph.X0, glyph.Y0 are drawing coordinates from base text position, and accounting for oversampling.
         out_glyph->X0 = x0 * recip_h + font_off_x;
         out_glyph->Y0 = y0 * recip_v + font_off_y;
-        out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
-        out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
+        out_glyph->X1 = (x0 + w) * recip_h + font_off_x;
+        out_glyph->Y1 = (y0 + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
-        out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
     }
 
     return true;
 }
 
+static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+        IM_ASSERT(bd_font_data);
+        int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+        if (glyph_index == 0)
+            return false;
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
+        const float scale_for_layout = bd_font_data->ScaleFactor * baked->Size;
+        *out_advance_x = advance * scale_for_layout;
+        return true;
+    }
+
+    // Rasterize then pack and retrieve position inside texture atlas
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->TempBuffer.resize(0);
+    ImFontGlyphBitmap bitmap(&builder->TempBuffer);
+    if (!ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(atlas, src, baked, NULL, NULL, codepoint, out_glyph, &bitmap))
+        return false;
+    if (out_glyph->Visible && !ImFontAtlasBakedPackFontGlyph(atlas, baked, src, out_glyph, &bitmap))
+        return false;
+    return true;
+}
+
 const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
 {
     static ImFontLoader loader;
@@ -4740,6 +6390,7 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplStbTrueType_FontBakedRasterizeGlyph;
     return &loader;
 }
 
@@ -5071,6 +6722,7 @@ ImFontBaked::ImFontBaked()
 {
     memset(this, 0, sizeof(*this));
     FallbackGlyphIndex = -1;
+    memset(AsciiGlyphIndex, 0xFF, sizeof(AsciiGlyphIndex));
 }
 
 void ImFontBaked::ClearOutputData()
@@ -5079,7 +6731,13 @@ void ImFontBaked::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    for (ImFontBakedIndexPage* page : IndexPages)
+        IM_FREE(page);
+    IndexPages.clear();
+    GlyphsLastUsedFrame.clear();
+    GlyphsFreeSlots.clear();
     FallbackGlyphIndex = -1;
+    memset(AsciiGlyphIndex, 0xFF, sizeof(AsciiGlyphIndex));
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
@@ -5124,10 +6782,23 @@ bool ImFont::IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last)
 // - 'src' is not necessarily == 'this->Sources' because multiple source fonts+configs can be used to build one target font.
 ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph)
 {
-    int glyph_idx = baked->Glyphs.Size;
-    baked->Glyphs.push_back(*in_glyph);
+    int glyph_idx;
+    if (baked->GlyphsFreeSlots.Size > 0)
+    {
+        glyph_idx = baked->GlyphsFreeSlots.back();
+        baked->GlyphsFreeSlots.pop_back();
+        baked->Glyphs[glyph_idx] = *in_glyph;
+    }
+    else
+    {
+        glyph_idx = baked->Glyphs.Size;
+        baked->Glyphs.push_back(*in_glyph);
+        baked->GlyphsLastUsedFrame.push_back(0);
+    }
+    baked->GlyphsLastUsedFrame[glyph_idx] = atlas->Builder->FrameCount; // Consider new glyphs as used, so they are not evicted while making space for them.
+    atlas->Builder->GlyphsLoadedCount++;
     ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
-    IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
+    IM_ASSERT(baked->Glyphs.Size < 0xFFFD); // IndexLookup[] hold 16-bit values and -1/-2/-3 are reserved.
 
     // Set UV from packed rectangle
     if (glyph->PackId != ImFontAtlasRectId_Invalid)
@@ -5166,9 +6837,7 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
-    baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    ImFontBaked_BuildSetIndex(baked, codepoint, (ImU16)glyph_idx, glyph->AdvanceX);
     const int page_n = codepoint / 8192;
     baked->OwnerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5194,8 +6863,7 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
         advance_x += src->GlyphExtraAdvanceX;
     }
 
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = advance_x;
+    ImFontBaked_BuildSetIndex(baked, codepoint, ImFontBaked_GetIndexLookup(baked, codepoint), advance_x);
 }
 
 // Copy to texture, post-process and queue update for backend
@@ -5209,6 +6877,36 @@ void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked,
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 }
 
+// Pack a glyph output by ImFontLoader::FontBakedRasterizeGlyph(), copy its pixels into the texture and queue upload.
+bool ImFontAtlasBakedPackFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, const ImFontGlyphBitmap* bitmap)
+{
+    IM_ASSERT(glyph->Visible && glyph->PackId == ImFontAtlasRectId_Invalid);
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, bitmap->Width, bitmap->Height);
+    if (pack_id == ImFontAtlasRectId_Invalid)
+    {
+        // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+        IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+        return false;
+    }
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+    glyph->PackId = pack_id;
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, glyph, r, bitmap->GetPixels(), bitmap->Format, bitmap->Width * ImTextureDataGetFormatBytesPerPixel(bitmap->Format));
+    return true;
+}
+
+// Offset is kept aligned so loaders can write e.g. 32-bit pixels.
+unsigned char* ImFontGlyphBitmap::AllocPixels(int w, int h, ImTextureFormat format)
+{
+    const int size = w * h * ImTextureDataGetFormatBytesPerPixel(format);
+    Offset = IM_MEMALIGN(Buffer->Size, 4);
+    Width = w;
+    Height = h;
+    Format = format;
+    Buffer->resize(Offset + size);
+    memset(Buffer->Data + Offset, 0, (size_t)size);
+    return Buffer->Data + Offset;
+}
+
 void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 {
     RemapPairs.SetInt((ImGuiID)from_codepoint, (int)to_codepoint);
@@ -5217,14 +6915,11 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
-    {
-        const int i = (int)IndexLookup.Data[c];
-        if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
-            return &Glyphs.Data[FallbackGlyphIndex];
-        if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return &Glyphs.Data[i];
-    }
+    const int i = (int)ImFontBaked_GetIndexLookup(this, c);
+    if (i == IM_FONTGLYPH_INDEX_NOT_FOUND || i == IM_FONTGLYPH_INDEX_PENDING)
+        return &Glyphs.Data[FallbackGlyphIndex];
+    if (i != IM_FONTGLYPH_INDEX_UNUSED)
+        return &Glyphs.Data[i];
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     return glyph ? glyph : &Glyphs.Data[FallbackGlyphIndex];
 }
@@ -5232,14 +6927,11 @@ ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 // Attempt to load but when missing, return NULL instead of FallbackGlyph
 ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
-    {
-        const int i = (int)IndexLookup.Data[c];
-        if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
-            return NULL;
-        if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return &Glyphs.Data[i];
-    }
+    const int i = (int)ImFontBaked_GetIndexLookup(this, c);
+    if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
+        return NULL;
+    if (i != IM_FONTGLYPH_INDEX_UNUSED && i != IM_FONTGLYPH_INDEX_PENDING) // Pending glyphs are loaded synchronously here.
+        return &Glyphs.Data[i];
     LoadNoFallback = true; // This is actually a rare call, not done in hot-loop, so we prioritize not adding extra cruft to ImFontBaked_BuildLoadGlyph() call sites.
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     LoadNoFallback = false;
@@ -5248,15 +6940,8 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
-    {
-        const int i = (int)IndexLookup.Data[c];
-        if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
-            return false;
-        if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return true;
-    }
-    return false;
+    const int i = (int)ImFontBaked_GetIndexLookup(this, c);
+    return i != IM_FONTGLYPH_INDEX_NOT_FOUND && i != IM_FONTGLYPH_INDEX_PENDING && i != IM_FONTGLYPH_INDEX_UNUSED;
 }
 
 // This is not fast query
@@ -5277,13 +6962,10 @@ bool ImFont::IsGlyphInFont(ImWchar c)
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
-    if ((int)c < IndexAdvanceX.Size)
-    {
-        // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
-        const float x = IndexAdvanceX.Data[c];
-        if (x >= 0.0f)
-            return x;
-    }
+    // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
+    const float x = ImFontBaked_GetIndexAdvanceX(this, c);
+    if (x >= 0.0f)
+        return x;
     return ImFontBaked_BuildLoadGlyphAdvanceX(this, c);
 }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
@@ -5308,14 +6990,25 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
 
     if (density < 0.0f)
         density = CurrentRasterizerDensity;
+    ImFontAtlas* atlas = OwnerAtlas;
+    if (atlas->Flags & ImFontAtlasFlags_DistanceField)
+    {
+        // Distance fields are scaled to any size and density: use a single baked size, at density 1.
+        size = atlas->DistanceFieldBakeSize;
+        density = 1.0f;
+    }
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
-    ImFontAtlas* atlas = OwnerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
     baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
     if (baked == NULL)
-        return NULL;
+        return baked;
+    if (builder->ReadOnlyForThreads) // Don't write to shared cache while recording on multiple threads, but still track usage for eviction
+    {
+        ImAtomicStoreRelaxed(&baked->LastUsedFrame, builder->FrameCount);
+        return baked;
+    }
     baked->LastUsedFrame = builder->FrameCount;
     LastBaked = baked;
     return baked;
@@ -5326,8 +7019,22 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
     // FIXME-NEWATLAS: Design for picking a nearest size based on some criteria?
     // FIXME-NEWATLAS: Altering font density won't work right away.
     IM_ASSERT(font_size > 0.0f && font_rasterizer_density > 0.0f);
+    if (atlas->Flags & ImFontAtlasFlags_DistanceField)
+    {
+        font_size = atlas->DistanceFieldBakeSize;
+        font_rasterizer_density = 1.0f;
+    }
     ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, font_rasterizer_density);
     ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->ReadOnlyForThreads)
+    {
+        // Read-only lookup. Sizes which haven't been used on the main thread use closest match.
+        ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(baked_id);
+        if (baked == NULL)
+            baked = ImFontAtlasBakedGetClosestMatch(atlas, font, font_size, font_rasterizer_density);
+        IM_ASSERT(baked != NULL && "Font has no baked size: use it once on the main thread before BeginDrawListsRecordingOnThreads()!");
+        return baked;
+    }
     ImFontBaked** p_baked_in_map = (ImFontBaked**)builder->BakedMap.GetVoidPtrRef(baked_id);
     ImFontBaked* baked = *p_baked_in_map;
     if (baked != NULL)
@@ -5496,6 +7203,7 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
     const char* word_wrap_eol = NULL;
 
     const char* s = text_begin;
+    const char* ascii_run_end = s;
     while (s < text_end_display)
     {
         // Word-wrapping
@@ -5519,6 +7227,29 @@ ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wra
             }
         }
 
+        // Fast path for runs of printable ASCII: no decoding, no control characters.
+        if (s >= ascii_run_end && (unsigned char)(*s - 0x20) < 0x60)
+            ascii_run_end = ImTextFindPrintableAsciiRunEnd(s, text_end_display);
+        if (s < ascii_run_end)
+        {
+            const char* run_end = (word_wrap_enabled && word_wrap_eol < ascii_run_end) ? word_wrap_eol : ascii_run_end;
+            while (s < run_end)
+            {
+                const unsigned int c = (unsigned char)*s;
+                float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+                if (char_width < 0.0f)
+                    char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+                char_width *= scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+                s++;
+            }
+            if (s < run_end)
+                break; // Reached max_width
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -5581,6 +7312,11 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     const ImFontGlyph* glyph = baked->FindGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
+    ImFontAtlasBuilder* builder = OwnerAtlas->Builder;
+    if (OwnerAtlas->TexMaxMemorySize > 0)
+        ImAtomicStoreRelaxed(&baked->GlyphsLastUsedFrame.Data[baked->Glyphs.index_from_ptr(glyph)], builder->FrameCount); // May be recording on multiple threads
+    if (!builder->ReadOnlyForThreads)
+        builder->GlyphsRenderedCount++;
     if (glyph->Colored)
         col |= ~IM_COL32_A_MASK;
     float scale = (size >= 0.0f) ? (size / baked->Size) : 1.0f;
@@ -5618,8 +7354,10 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags)
 {
     // Align to be pixel perfect
+    // Pen position 'x' is relative to origin_x, same as ImFontCalcTextSizeEx() and ImFontBuildTextLayout(), so cached layouts render identically.
 begin:
-    float x = IM_TRUNC(pos.x);
+    const float origin_x = IM_TRUNC(pos.x);
+    float x = 0.0f;
     float y = IM_TRUNC(pos.y);
     if (y > clip_rect.w)
         return;
@@ -5631,7 +7369,6 @@ begin:
     ImFontBaked* baked = GetFontBaked(size);
 
     const float scale = size / baked->Size;
-    const float origin_x = x;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
 
     // Fast-forward to first visible line
@@ -5682,9 +7419,12 @@ begin:
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
     const int cmd_count = draw_list->CmdBuffer.Size;
     const bool cpu_fine_clip = (flags & ImDrawTextFlags_CpuFineClip) != 0;
+    ImFontAtlasBuilder* builder = OwnerAtlas->Builder;
+    const int glyphs_used_frame = (OwnerAtlas->TexMaxMemorySize > 0) ? builder->FrameCount : -1; // Track glyphs usage for eviction
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const char* ascii_run_end = s;
 
     while (s < text_end)
     {
@@ -5692,11 +7432,11 @@ begin:
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
             if (!word_wrap_eol)
-                word_wrap_eol = ImFontCalcWordWrapPositionEx(this, size, s, text_end, wrap_width - (x - origin_x), flags);
+                word_wrap_eol = ImFontCalcWordWrapPositionEx(this, size, s, text_end, wrap_width - x, flags);
 
             if (s >= word_wrap_eol)
             {
-                x = origin_x;
+                x = 0.0f;
                 y += line_height;
                 if (y > clip_rect.w)
                     break; // break out of main loop
@@ -5707,36 +7447,53 @@ begin:
         }
 
         // Decode and advance source
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
+        // Fast path for runs of printable ASCII: no decoding, no control characters, glyphs from dense table.
+        const ImFontGlyph* glyph;
+        unsigned int c = (unsigned char)*s;
+        if (s >= ascii_run_end && c - 0x20 < 0x60)
+            ascii_run_end = ImTextFindPrintableAsciiRunEnd(s, text_end);
+        if (s < ascii_run_end)
+        {
             s += 1;
+            const ImU16 glyph_index = baked->AsciiGlyphIndex[c - 0x20];
+            glyph = (glyph_index != IM_FONTGLYPH_INDEX_UNUSED) ? &baked->Glyphs.Data[glyph_index] : BuildLoadGlyphFillAsciiIndex(baked, c);
+        }
         else
-            s += ImTextCharFromUtf8(&c, s, text_end);
-
-        if (c < 32)
         {
-            if (c == '\n')
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+
+            if (c < 32)
             {
-                x = origin_x;
-                y += line_height;
-                if (y > clip_rect.w)
-                    break; // break out of main loop
-                continue;
+                if (c == '\n')
+                {
+                    x = 0.0f;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
             }
-            if (c == '\r')
-                continue;
-        }
 
-        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+            glyph = baked->FindGlyph((ImWchar)c);
+        }
         //if (glyph == NULL)
         //    continue;
 
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
         {
+            if (glyphs_used_frame != -1)
+                ImAtomicStoreRelaxed(&baked->GlyphsLastUsedFrame.Data[glyph - baked->Glyphs.Data], glyphs_used_frame); // May be recording on multiple threads
+
             // We don't do a second finer clipping test on the Y axis as we've already skipped anything before clip_rect.y and exit once we pass clip_rect.w
-            float x1 = x + glyph->X0 * scale;
-            float x2 = x + glyph->X1 * scale;
+            const float pen_x = origin_x + x;
+            float x1 = pen_x + glyph->X0 * scale;
+            float x2 = pen_x + glyph->X1 * scale;
             float y1 = y + glyph->Y0 * scale;
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
@@ -5812,6 +7569,8 @@ begin:
     }
 
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    if (!builder->ReadOnlyForThreads)
+        builder->GlyphsRenderedCount += (ImU64)((vtx_write - draw_list->_VtxWritePtr) / 4);
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
     draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
@@ -5820,6 +7579,169 @@ begin:
     draw_list->_VtxCurrentIdx = vtx_index;
 }
 
+// Compute size and glyph positions of a text, for ImFontRenderTextLayout(). Used by the text layout cache (io.ConfigTextLayoutCache).
+// Size is the same as ImFontCalcTextSizeEx() output. Positions are accumulated exactly like RenderText() does (relative to the line start),
+// so ImFontRenderTextLayout() outputs the same vertices as RenderText().
+void ImFontBuildTextLayout(ImFont* font, float size, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags, ImFontTextLayout* out_layout)
+{
+    if (!text_end)
+        text_end = text_begin + ImStrlen(text_begin);
+    out_layout->Size = ImFontCalcTextSizeEx(font, size, FLT_MAX, wrap_width, text_begin, text_end, text_end, NULL, NULL, flags);
+    out_layout->Glyphs.resize(0);
+
+    ImFontBaked* baked = font->GetFontBaked(size);
+    const float scale = size / baked->Size;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    float x = 0.0f;
+    int line = 0;
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = ImFontCalcWordWrapPositionEx(font, size, s, text_end, wrap_width - x, flags);
+
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                line++;
+                word_wrap_eol = NULL;
+                s = ImTextCalcWordWrapNextLineStart(s, text_end, flags); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c == '\n')
+        {
+            x = 0.0f;
+            line++;
+            continue;
+        }
+        if (c == '\r')
+            continue;
+
+        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+        if (glyph->Visible)
+        {
+            ImFontTextLayoutGlyph layout_glyph;
+            layout_glyph.X = x;
+            layout_glyph.Line = line;
+            layout_glyph.Codepoint = c;
+            out_layout->Glyphs.push_back(layout_glyph);
+        }
+        x += glyph->AdvanceX * scale;
+    }
+}
+
+// Render a layout built by ImFontBuildTextLayout(). Same clipping rules as RenderText(): no word-wrapping or UTF-8 decoding needed here.
+// Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
+void ImFontRenderTextLayout(ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const ImFontTextLayout* layout, ImDrawTextFlags flags)
+{
+begin:
+    const float x = IM_TRUNC(pos.x);
+    const float y = IM_TRUNC(pos.y);
+    if (y > clip_rect.w || layout->Glyphs.Size == 0)
+        return;
+
+    const float line_height = size;
+    ImFontBaked* baked = font->GetFontBaked(size);
+    const float scale = size / baked->Size;
+
+    const int vtx_count_max = layout->Glyphs.Size * 4;
+    const int idx_count_max = layout->Glyphs.Size * 6;
+    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    const int cmd_count = draw_list->CmdBuffer.Size;
+    const bool cpu_fine_clip = (flags & ImDrawTextFlags_CpuFineClip) != 0;
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    ImFontAtlasBuilder* builder = font->OwnerAtlas->Builder;
+    const int glyphs_used_frame = (font->OwnerAtlas->TexMaxMemorySize > 0) ? builder->FrameCount : -1; // Track glyphs usage for eviction
+
+    float line_y = y;
+    int line = 0;
+    for (const ImFontTextLayoutGlyph& layout_glyph : layout->Glyphs)
+    {
+        // Advance line position one line at a time like RenderText(). Skip lines above clip_rect.y, stop at first line below clip_rect.w
+        for (; line < layout_glyph.Line; line++)
+            line_y += line_height;
+        if (line_y + line_height < clip_rect.y)
+            continue;
+        if (line_y > clip_rect.w)
+            break;
+
+        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)layout_glyph.Codepoint);
+        if (!glyph->Visible)
+            continue;
+        if (glyphs_used_frame != -1)
+            ImAtomicStoreRelaxed(&baked->GlyphsLastUsedFrame.Data[glyph - baked->Glyphs.Data], glyphs_used_frame); // May be recording on multiple threads
+        float x1 = x + layout_glyph.X + glyph->X0 * scale;
+        float x2 = x + layout_glyph.X + glyph->X1 * scale;
+        float y1 = line_y + glyph->Y0 * scale;
+        float y2 = line_y + glyph->Y1 * scale;
+        if (x1 > clip_rect.z || x2 < clip_rect.x)
+            continue;
+        float u1 = glyph->U0;
+        float v1 = glyph->V0;
+        float u2 = glyph->U1;
+        float v2 = glyph->V1;
+
+        // CPU side clipping used to fit text in their frame when the frame is too small. Only does clipping for axis aligned quads.
+        if (cpu_fine_clip)
+        {
+            if (x1 < clip_rect.x) { u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1); x1 = clip_rect.x; }
+            if (y1 < clip_rect.y) { v1 = v1 + (1.0f - (y2 - clip_rect.y) / (y2 - y1)) * (v2 - v1); y1 = clip_rect.y; }
+            if (x2 > clip_rect.z) { u2 = u1 + ((clip_rect.z - x1) / (x2 - x1)) * (u2 - u1); x2 = clip_rect.z; }
+            if (y2 > clip_rect.w) { v2 = v1 + ((clip_rect.w - y1) / (y2 - y1)) * (v2 - v1); y2 = clip_rect.w; }
+            if (y1 >= y2)
+                continue;
+        }
+
+        // Support for untinted glyphs
+        ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+
+    // Edge case: glyphs reloaded by FindGlyph() triggering a texture change (see RenderText()).
+    if (cmd_count != draw_list->CmdBuffer.Size) //-V547
+    {
+        IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
+        draw_list->CmdBuffer.pop_back();
+        draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
+        draw_list->AddDrawCmd();
+        goto begin;
+    }
+
+    // Give back unused vertices (clipped ones)
+    if (!builder->ReadOnlyForThreads)
+        builder->GlyphsRenderedCount += (ImU64)((vtx_write - draw_list->_VtxWritePtr) / 4);
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGui Internal Render Helpers
 //-----------------------------------------------------------------------------
@@ -58,6 +58,9 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _InterlockedExchange, _InterlockedExchangeAdd, _InterlockedCompareExchange
+#endif
 
 // Enable SSE intrinsics if available
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
@@ -72,6 +75,16 @@ Index of this file:
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
+// Hash 8 bytes per step (see IMGUI_USE_FAST_CRC32 in imconfig.h). Only for CRC32c, so legacy CRC32-adler IDs are never altered.
+#if defined(IMGUI_USE_FAST_CRC32) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+#if defined(IMGUI_ENABLE_SSE4_2_CRC)
+#define IMGUI_ENABLE_FAST_CRC32
+#elif defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+#define IMGUI_ENABLE_FAST_CRC32
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#endif
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -137,11 +150,14 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
+struct ImGuiFrameArena;             // Linear allocator for transient memory, reset every frame.
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
+struct ImFontAtlasGlyphAsyncBatch;  // Glyphs being loaded by an asynchronous job (see ImFontAtlas::RunAsync)
+struct ImFontAtlasGlyphAsyncRequest;// Glyph queued for asynchronous loading
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
 
@@ -345,6 +361,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helpers: Hashing
 // - Helpers: Sorting
 // - Helpers: Bit manipulation
+// - Helpers: Atomics
 // - Helpers: String
 // - Helpers: Formatting
 // - Helpers: UTF-8 <> wchar conversions
@@ -361,6 +378,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
 // - Helper: ImGuiTextIndex
+// - Helper: ImGuiFrameArena, ImFrameVector<>
 // - Helper: ImGuiStorage
 //-----------------------------------------------------------------------------
 
@@ -383,6 +401,18 @@ inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (
 inline int              ImUpperPowerOfTwo(int v)            { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 inline unsigned int     ImCountSetBits(unsigned int v)      { unsigned int count = 0; while (v > 0) { v = v & (v - 1); count++; } return count; }
 
+// Helpers: Atomics (minimal set, for flags and counters shared with jobs running on worker threads. We don't include <atomic>)
+#if defined(_MSC_VER) && !defined(__clang__)
+inline long             ImAtomicLoad(volatile long* p)              { return _InterlockedCompareExchange(p, 0, 0); }
+inline void             ImAtomicStore(volatile long* p, long v)     { _InterlockedExchange(p, v); }
+inline void             ImAtomicStoreRelaxed(volatile int* p, int v){ *p = v; } // Aligned 32-bit volatile stores are atomic with MSVC
+#else
+inline long             ImAtomicLoad(volatile long* p)              { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+inline void             ImAtomicStore(volatile long* p, long v)     { __atomic_store_n(p, v, __ATOMIC_SEQ_CST); }
+inline void             ImAtomicStoreRelaxed(volatile int* p, int v){ __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+#endif
+IMGUI_API void          ImThreadYield();                            // Let other threads run (SwitchToThread()/sched_yield()). Used while waiting for jobs.
+
 // Helpers: String
 #define ImStrlen strlen
 #define ImMemchr memchr
@@ -442,6 +472,22 @@ IMGUI_API ImVec2        ImFontCalcTextSizeEx(ImFont* font, float size, float max
 IMGUI_API const char*   ImFontCalcWordWrapPositionEx(ImFont* font, float size, const char* text, const char* text_end, float wrap_width, ImDrawTextFlags flags = 0);
 IMGUI_API const char*   ImTextCalcWordWrapNextLineStart(const char* text, const char* text_end, ImDrawTextFlags flags = 0); // trim trailing space and find beginning of next line
 
+// Helpers: Pre-computed text layout, used by the text layout cache (io.ConfigTextLayoutCache)
+// Glyphs are stored by codepoint and looked up again when rendering, so layouts stay valid when the atlas texture is repacked.
+struct ImFontTextLayoutGlyph
+{
+    float           X;                      // Pen position relative to the line start (glyph offsets X0/Y0 are added when rendering)
+    int             Line;                   // Line index, including lines without visible glyphs
+    unsigned int    Codepoint;
+};
+struct ImFontTextLayout
+{
+    ImVec2                          Size;   // Same as ImFontCalcTextSizeEx() without max_width
+    ImVector<ImFontTextLayoutGlyph> Glyphs; // Visible glyphs only (no blanks), in line order
+};
+IMGUI_API void          ImFontBuildTextLayout(ImFont* font, float size, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags, ImFontTextLayout* out_layout);
+IMGUI_API void          ImFontRenderTextLayout(ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const ImFontTextLayout* layout, ImDrawTextFlags flags);
+
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
@@ -814,6 +860,51 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImGuiFrameArena
+// Linear allocator for transient memory, reset by NewFrame(). Allocations are never freed individually.
+// When a frame needs more than the current block, more blocks are allocated, then replaced by a single block large enough
+// for that frame on next reset(): frames using as much memory don't call MemAlloc()/MemFree() anymore.
+struct ImGuiFrameArenaBlock
+{
+    char*           Data;
+    size_t          Size;
+};
+
+struct ImGuiFrameArena
+{
+    ImVector<ImGuiFrameArenaBlock> Blocks;
+    size_t          BlockUsed;                              // Bytes used in last block
+    size_t          UsedSize;                               // Bytes allocated since last reset()
+    size_t          HighWaterSize;                          // Largest UsedSize reached before a reset()
+
+    ImGuiFrameArena()                                       { BlockUsed = UsedSize = HighWaterSize = 0; }
+    ~ImGuiFrameArena()                                      { clear(); }
+    IMGUI_API void* alloc(size_t size);                     // Returned memory is aligned on 16 bytes and valid until next reset()
+    IMGUI_API void  reset();
+    IMGUI_API void  clear();                                // Free all blocks
+    size_t          capacity() const                        { size_t sz = 0; for (const ImGuiFrameArenaBlock& block : Blocks) sz += block.Size; return sz; }
+};
+
+// Helper: ImFrameVector<>
+// Minimal vector storing its data in current context's ImGuiFrameArena (see ImGui::MemAllocFrame()): nothing to free, and no heap allocation in steady state.
+// Data is only valid until next NewFrame(): call reset() before using it in a new frame. Only use with POD types.
+namespace ImGui { IMGUI_API void* MemAllocFrame(size_t size); }
+template<typename T>
+struct ImFrameVector
+{
+    int                 Size;
+    int                 Capacity;
+    T*                  Data;
+
+    inline ImFrameVector()                          { Size = Capacity = 0; Data = NULL; }
+    inline void         reset()                     { Size = Capacity = 0; Data = NULL; }
+    inline bool         empty() const               { return Size == 0; }
+    inline T&           back()                      { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+    inline void         pop_back()                  { IM_ASSERT(Size > 0); Size--; }
+    inline void         push_back(const T& v)       { if (Size == Capacity) grow(); memcpy(&Data[Size], &v, sizeof(v)); Size++; } // Previous storage stays valid until next NewFrame(): 'v' may point into it.
+    inline void         grow()                      { int new_capacity = Capacity ? Capacity * 2 : 8; T* new_data = (T*)ImGui::MemAllocFrame((size_t)new_capacity * sizeof(T)); if (Data) memcpy(new_data, Data, (size_t)Size * sizeof(T)); Data = new_data; Capacity = new_capacity; }
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -846,6 +937,19 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Number of unit circle rings cached in ImDrawListSharedData, for shapes using an explicit or non-lookup-table segment count.
+#ifndef IM_DRAWLIST_RING_CACHE_SIZE
+#define IM_DRAWLIST_RING_CACHE_SIZE                             8
+#endif
+
+// Points of a unit circle divided in SegmentCount segments, see ImDrawListSharedData::GetUnitRing()
+struct ImDrawListUnitRing
+{
+    int                 SegmentCount;           // 0 when unused
+    unsigned int        LastUsed;               // Value of ImDrawListSharedData::RingsUseCounter when last used, for LRU eviction
+    ImVector<ImVec2>    Points;                 // SegmentCount points: (cos(a), sin(a)) with a = 2*PI*n/SegmentCount
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -853,7 +957,7 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 struct IMGUI_API ImDrawListSharedData
 {
     ImVec2          TexUvWhitePixel;            // UV of white pixel in the atlas (== FontAtlas->TexUvWhitePixel)
-    const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas (== FontAtlas->TexUvLines)
+    const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas (== FontAtlas->TexUvLines, NULL if FontAtlas has no baked lines)
     ImFontAtlas*    FontAtlas;                  // Current font atlas
     ImFont*         Font;                       // Current font (used for simplified AddText overload)
     float           FontSize;                   // Current font size (used for for simplified AddText overload)
@@ -871,10 +975,14 @@ struct IMGUI_API ImDrawListSharedData
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
+    ImDrawListUnitRing Rings[IM_DRAWLIST_RING_CACHE_SIZE]; // Small LRU cache of unit circle rings, keyed by segment count (AddCircle/AddNgon with explicit segment count, AddEllipse)
+    unsigned int    RingsUseCounter;
 
     ImDrawListSharedData();
     ~ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    const ImVec2* GetUnitRing(int segment_count);                    // Return NULL if segment_count > IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX
+    void CopySettingsFrom(const ImDrawListSharedData* src);         // Copy everything but TempBuffer[], DrawLists[] and Rings[]. Used to sync per-thread instances, see BeginDrawListsRecordingOnThreads().
 };
 
 struct ImDrawDataBuilder
@@ -892,6 +1000,34 @@ struct ImFontStackData
     float       FontSizeAfterScaling;       // ~~ g.FontSize
 };
 
+// Text layout cache (io.ConfigTextLayoutCache)
+#ifndef IM_TEXTLAYOUT_CACHE_SIZE
+#define IM_TEXTLAYOUT_CACHE_SIZE            4096    // Number of entries kept across frames. Above that, entries not used during last frame are evicted.
+#endif
+#ifndef IM_TEXTLAYOUT_CACHE_EVICT_BATCH
+#define IM_TEXTLAYOUT_CACHE_EVICT_BATCH     64      // Minimum number of entries checked for eviction per frame while above IM_TEXTLAYOUT_CACHE_SIZE.
+#endif
+#ifndef IM_TEXTLAYOUT_CACHE_MAX_TEXT_LEN
+#define IM_TEXTLAYOUT_CACHE_MAX_TEXT_LEN    2048    // Longer text are not cached.
+#endif
+
+struct ImGuiTextLayoutCacheEntry
+{
+    ImGuiID             Key;                // Hash of text, font, baked size and wrap width
+    int                 LastUsedFrame;
+    int                 BakedClearedCount;  // Value of ImFontAtlasBuilder::BakedClearedCount when built. Entry is rebuilt when it changed.
+    ImFont*             Font;               // Font, baked font, size and wrap width, to detect hash collisions
+    ImGuiID             BakedId;
+    float               Size;
+    float               WrapWidth;
+    ImVector<char>      Text;               // Copy of text, to detect hash collisions
+    ImFontTextLayout    Layout;
+    bool                HasGlyphs;          // Layout.Glyphs[] was built. False for text only measured with CalcTextSize(), which only stores Layout.Size.
+
+    ImGuiTextLayoutCacheEntry()             { Key = 0; LastUsedFrame = BakedClearedCount = -1; Font = NULL; BakedId = 0; Size = WrapWidth = 0.0f; HasGlyphs = false; }
+    bool                Matches(ImFont* font, ImGuiID baked_id, float size, float wrap_width, const char* text, int text_len) const { return Font == font && BakedId == baked_id && Size == size && WrapWidth == wrap_width && Text.Size == text_len && memcmp(Text.Data, text, (size_t)text_len) == 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Style support
 //-----------------------------------------------------------------------------
@@ -1280,6 +1416,7 @@ enum ImGuiWindowRefreshFlags_
     ImGuiWindowRefreshFlags_TryToAvoidRefresh   = 1 << 0,   // [EXPERIMENTAL] Try to keep existing contents, USER MUST NOT HONOR BEGIN() RETURNING FALSE AND NOT APPEND.
     ImGuiWindowRefreshFlags_RefreshOnHover      = 1 << 1,   // [EXPERIMENTAL] Always refresh on hover
     ImGuiWindowRefreshFlags_RefreshOnFocus      = 1 << 2,   // [EXPERIMENTAL] Always refresh on focus
+    ImGuiWindowRefreshFlags_RefreshOnInput      = 1 << 3,   // [EXPERIMENTAL] Always refresh on frames where mouse button/wheel, keyboard or text events were received
     // Refresh policy/frequency, Load Balancing etc.
 };
 
@@ -1422,6 +1559,23 @@ struct ImGuiWindowStackData
     float                   DisabledOverrideReenableAlphaBackup;
 };
 
+// Uniform grid over rectangles of active windows, built in EndFrame() when there are many windows (see UpdateWindowsHitGrid()).
+// Used by FindHoveredWindowEx() to only test windows overlapping the given position.
+struct ImGuiWindowsHitGrid
+{
+    bool                    Valid;                      // Invalidated when g.Windows[] display order or a window rectangle changes
+    int                     CellsX, CellsY;
+    ImRect                  Bounds;                     // Union of padded window rectangles
+    ImVec2                  CellSizeInv;
+    ImVec2                  Padding;                    // Hit padding included in window rectangles (largest padding used by FindHoveredWindowEx())
+    ImVector<int>           CellStart;                  // Offset of each cell in CellWindows[], + end offset
+    ImVector<ImGuiWindow*>  CellWindows;                // Windows overlapping each cell, in display order (back to front)
+    ImVector<ImGuiWindow*>  Windows;                    // [Temporary] Active windows, in display order
+    ImVector<ImRect>        Rects;                      // [Temporary] Their padded rectangles
+
+    ImGuiWindowsHitGrid()   { Valid = false; CellsX = CellsY = 0; }
+};
+
 struct ImGuiShrinkWidthItem
 {
     int         Index;
@@ -1953,6 +2107,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImVector<ImDrawList*> DrawDataMergedLists;  // Output lists when io.ConfigDrawDataMergeLists is set, reused every frame
 
     // Per-viewport work area
     // - Insets are >= 0.0f values, distance from viewport corners to work area.
@@ -1964,7 +2119,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImVec2              BuildWorkInsetMax;      // "
 
     ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); for (ImDrawList* draw_list : DrawDataMergedLists) IM_DELETE(draw_list); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& inset_min) const                           { return ImVec2(Pos.x + inset_min.x, Pos.y + inset_min.y); }
@@ -2190,6 +2345,16 @@ struct ImGuiContext
     float                   FontRasterizerDensity;              // Current font density. Used by all calls to GetFontBaked().
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale == CurrentViewport->DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImVector<ImDrawListSharedData*> DrawListSharedDataThreads;  // Per-thread shared data for multi-threaded ImDrawList recording. See AddDrawListSharedDataForThread().
+    bool                    DrawListsRecordingOnThreads;        // Set between BeginDrawListsRecordingOnThreads() and EndDrawListsRecordingOnThreads()
+    ImVector<ImGuiTextLayoutCacheEntry*> TextLayoutCache;       // Text layout cache (io.ConfigTextLayoutCache). See FindOrBuildTextLayout().
+    ImGuiStorage            TextLayoutCacheMap;                 // Key -> index in TextLayoutCache[]
+    ImGuiTextLayoutCacheEntry* TextLayoutCacheLastEntry;        // Last entry returned: checked before hashing, as text is often measured then rendered.
+    int                     TextLayoutCacheEvictCursor;         // Index of next entry to check for eviction. See UpdateTextLayoutCacheNewFrame().
+    int                     TextLayoutCacheHits;                // Stats: lookups served from cache / rebuilt (current frame)
+    int                     TextLayoutCacheMisses;
+    int                     TextLayoutCacheHitsLastFrame;       // Stats: same as above, for last frame
+    int                     TextLayoutCacheMissesLastFrame;
     ImGuiID                 WithinEndChildID;                   // Set within EndChild()
     void*                   TestEngine;                         // Test engine user data
 
@@ -2205,6 +2370,7 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
+    ImGuiWindowsHitGrid     WindowsHitGrid;                     // Spatial index of active windows, to find hovered window
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     float                   WindowsBorderHoverPadding;          // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, style.WindowBorderHoverPadding). This isn't so multi-dpi friendly.
     ImGuiID                 DebugBreakInWindow;                 // Set to break in Begin() call.
@@ -2529,6 +2695,7 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    int                     DebugDrawCmdsCountBeforeMerge;      // Draw commands output by last Render() before io.ConfigDrawDataMergeLists merging
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2543,6 +2710,7 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImGuiFrameArena         FrameArena;                         // Transient memory valid until next NewFrame(), see MemAllocFrame()
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas);
@@ -2603,8 +2771,8 @@ struct IMGUI_API ImGuiWindowTempData
     // We store the current settings outside of the vectors to increase memory locality (reduce cache misses). The vectors are rarely modified. Also it allows us to not heap allocate for short-lived windows which are not using those settings.
     float                   ItemWidth;              // Current item width (>0.0: width in pixels, <0.0: align xx pixels to the right of window).
     float                   TextWrapPos;            // Current text wrap pos.
-    ImVector<float>         ItemWidthStack;         // Store item widths to restore (attention: .back() is not == ItemWidth)
-    ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
+    ImFrameVector<float>    ItemWidthStack;         // Store item widths to restore (attention: .back() is not == ItemWidth). Reset on first Begin() of the frame.
+    ImFrameVector<float>    TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos). Reset on first Begin() of the frame.
 };
 
 // Storage for one window
@@ -2633,6 +2801,7 @@ struct IMGUI_API ImGuiWindow
     ImGuiID                 MoveId;                             // == window->GetID("#MOVE")
     ImGuiID                 ChildId;                            // ID of corresponding item in parent window (for navigation to return from child window to parent window)
     ImGuiID                 PopupId;                            // ID in the popup stack when this window is used as a popup/menu (because we use generic Name/ID for recycling)
+    ImGuiID                 SkipRefreshInputsHash;              // [EXPERIMENTAL] Hash of state affecting drawn contents (pos, size, scroll, hovered, focused, font atlas texture...) when last refreshed. See UpdateWindowSkipRefresh().
     ImVec2                  Scroll;
     ImVec2                  ScrollMax;
     ImVec2                  ScrollTarget;                       // target scroll position. stored as cursor position with scrolling canceled out, so the highest point is always 0.0f. (FLT_MAX for no change)
@@ -2649,6 +2818,7 @@ struct IMGUI_API ImGuiWindow
     bool                    WantCollapseToggle;
     bool                    SkipItems;                          // Set when items can safely be all clipped (e.g. window not visible or collapsed)
     bool                    SkipRefresh;                        // [EXPERIMENTAL] Reuse previous frame drawn contents, Begin() returns false.
+    bool                    SkipRefreshRequested;               // [EXPERIMENTAL] Set by RequestWindowRefresh(): don't reuse previous frame drawn contents on next Begin().
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
@@ -2661,6 +2831,7 @@ struct IMGUI_API ImGuiWindow
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
     short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
+    int                     DisplayOrder;                       // Order within Windows[], altered when windows are brought to front/back and sorted in EndFrame().
     ImGuiDir                AutoPosLastDirection;
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     bool                    AutoFitOnlyGrows;
@@ -3160,6 +3331,7 @@ namespace ImGui
 
     // Windows: Idle, Refresh Policies [EXPERIMENTAL]
     IMGUI_API void          SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags flags);
+    IMGUI_API void          RequestWindowRefresh(ImGuiWindow* window);   // [EXPERIMENTAL] Invalidate contents reused by ImGuiWindowRefreshFlags_TryToAvoidRefresh, e.g. when underlying data changed.
 
     // Fonts, drawing
     IMGUI_API void          RegisterUserTexture(ImTextureData* tex); // Register external texture. EXPERIMENTAL: DO NOT USE YET.
@@ -3178,6 +3350,20 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+    IMGUI_API const ImFontTextLayout* FindOrBuildTextLayout(ImFont* font, float size, const char* text, const char* text_end, float wrap_width, bool need_glyphs = true); // Return NULL when io.ConfigTextLayoutCache is disabled or text is too long. Valid until next NewFrame(). Glyphs[] may be empty when !need_glyphs.
+
+    // Multi-threaded ImDrawList recording (EXPERIMENTAL)
+    // - Each worker thread needs its own ImDrawListSharedData (TempBuffer[] is written to by AddPolyline(), AddConvexPolyFilled() etc.).
+    //   Register it with AddDrawListSharedDataForThread(), then create worker ImDrawList instances using it. Both need to be done on the main thread.
+    // - Each frame, on the main thread: BeginDrawListsRecordingOnThreads() syncs settings and resets every ImDrawList owned by registered data,
+    //   then dispatch recording jobs, wait for them, call EndDrawListsRecordingOnThreads() and after Render() use ImDrawData::AddDrawList() to append the lists.
+    // - Font atlas is read-only while recording: no glyph loading and no new font sizes. Missing glyphs are rendered with the fallback glyph,
+    //   so make sure glyphs are loaded beforehand (e.g. ImFontBaked::FindGlyph() on the main thread, or text already displayed in a previous frame).
+    // - The main thread may not use Dear ImGui while worker threads are recording.
+    IMGUI_API void          AddDrawListSharedDataForThread(ImDrawListSharedData* data);
+    IMGUI_API void          RemoveDrawListSharedDataForThread(ImDrawListSharedData* data);
+    IMGUI_API void          BeginDrawListsRecordingOnThreads();
+    IMGUI_API void          EndDrawListsRecordingOnThreads();
 
     // Init
     IMGUI_API void          Initialize();
@@ -3658,6 +3844,9 @@ namespace ImGui
     IMGUI_API void          ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp);
     IMGUI_API void          ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& pivot_in, float cos_a, float sin_a, const ImVec2& pivot_out);
 
+    // Transient memory
+    IMGUI_API void*         MemAllocFrame(size_t size);         // Allocate memory valid until next NewFrame(), from g.FrameArena. Never free it.
+
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
@@ -3675,6 +3864,8 @@ namespace ImGui
 
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API void          DebugAllocHookBeginSkipThread();    // Don't record allocations made by current thread until matching End call. Used by jobs running on worker threads.
+    IMGUI_API void          DebugAllocHookEndSkipThread();
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
@@ -3730,6 +3921,20 @@ namespace ImGui
 // [SECTION] ImFontLoader
 //-----------------------------------------------------------------------------
 
+// Glyph pixels output by ImFontLoader::FontBakedRasterizeGlyph(), before being packed into the atlas.
+struct ImFontGlyphBitmap
+{
+    ImVector<unsigned char>*    Buffer;             // Scratch buffer owned by caller (one per thread). Pixels are appended to it.
+    int                         Offset;             // Offset of pixels in Buffer->Data
+    int                         Width;
+    int                         Height;
+    ImTextureFormat             Format;
+
+    ImFontGlyphBitmap(ImVector<unsigned char>* buffer) { memset((void*)this, 0, sizeof(*this)); Buffer = buffer; }
+    IMGUI_API unsigned char*    AllocPixels(int w, int h, ImTextureFormat format); // Append w*h cleared pixels to Buffer. Pitch == w * bytes per pixel.
+    const unsigned char*        GetPixels() const   { return Buffer->Data + Offset; }
+};
+
 // Hooks and storage for a given font backend.
 // This structure is likely to evolve as we add support for incremental atlas updates.
 // Conceptually this could be public, but API is still going to be evolve.
@@ -3745,9 +3950,18 @@ struct ImFontLoader
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
 
+    // [EXPERIMENTAL] Optional: thread-safe rasterization, used by ImFontAtlasBakedLoadGlyphs() to rasterize glyphs from worker threads.
+    // - FontBakedThreadInit()/FontBakedThreadDestroy() are called on main thread, for each job and source. 'loader_data_for_thread' points to FontBakedThreadLoaderDataSize bytes.
+    // - FontBakedRasterizeGlyph() may be called concurrently for different 'loader_data_for_thread' (NULL when called from main thread only).
+    //   It must not pack nor write into the atlas: pixels are appended to 'out_bitmap', packing is done afterwards on main thread with ImFontAtlasBakedPackFontGlyph().
+    bool            (*FontBakedThreadInit)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, void* loader_data_for_thread);
+    void            (*FontBakedThreadDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_thread);
+    bool            (*FontBakedRasterizeGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, void* loader_data_for_thread, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontGlyphBitmap* out_bitmap);
+
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
     size_t          FontBakedSrcLoaderDataSize;
+    size_t          FontBakedThreadLoaderDataSize;  // Per Job * Per Source, for FontBakedThreadInit()
 
     ImFontLoader()  { memset(this, 0, sizeof(*this)); }
 };
@@ -3766,6 +3980,17 @@ typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are
 #define IMGUI_FONT_SIZE_MAX                                     (512.0f)
 #define IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE      (128.0f)
 
+// ImFontBaked lookup tables: code-points < IM_FONTBAKED_INDEX_DENSE_SIZE (Latin, Greek, Cyrillic) use dense arrays, other
+// code-points use pages allocated on demand, so e.g. using a single emoji doesn't allocate tables for 128K code-points.
+#define IM_FONTBAKED_INDEX_DENSE_SIZE       (0x500)
+#define IM_FONTBAKED_INDEX_PAGE_SHIFT       (8)
+#define IM_FONTBAKED_INDEX_PAGE_SIZE        (1 << IM_FONTBAKED_INDEX_PAGE_SHIFT)
+struct ImFontBakedIndexPage
+{
+    float                   AdvanceX[IM_FONTBAKED_INDEX_PAGE_SIZE];     // Same as ImFontBaked::IndexAdvanceX[]
+    ImU16                   GlyphIndex[IM_FONTBAKED_INDEX_PAGE_SIZE];   // Same as ImFontBaked::IndexLookup[]
+};
+
 // Helpers: ImTextureRef ==/!= operators provided as convenience
 // (note that _TexID and _TexData are never set simultaneously)
 inline bool operator==(const ImTextureRef& lhs, const ImTextureRef& rhs)    { return lhs._TexID == rhs._TexID && lhs._TexData == rhs._TexData; }
@@ -3808,6 +4033,14 @@ struct ImFontAtlasPostProcessData
     int                 Height;
 };
 
+// Glyph queued for asynchronous loading (see ImFontAtlas::RunAsync).
+// Until loaded, ImFontBaked::IndexLookup[] marks it as pending and the fallback glyph is used.
+struct ImFontAtlasGlyphAsyncRequest
+{
+    ImGuiID             BakedId;
+    ImWchar             Codepoint;
+};
+
 // We avoid dragging imstb_rectpack.h into public header (partly because binding generators are having issues with it)
 #ifdef IMGUI_STB_NAMESPACE
 namespace IMGUI_STB_NAMESPACE { struct stbrp_node; }
@@ -3823,24 +4056,42 @@ struct ImFontAtlasBuilder
 {
     stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
     ImVector<stbrp_node_im>     PackNodes;
+    ImVector<ImTextureRect>     PackFreeRects;          // Space freed by ImFontAtlasPackDiscardRect() below the packer's skyline, including padding. Reused before packing new space. Pixels are cleared.
+    ImVector<ImTextureRect>     PackFreeRectsPending;   // Space freed during current frame. Pixels are left untouched, as vertices may already use them. ImFontAtlasUpdateNewFrame() clears them and moves them to PackFreeRects[].
     ImVector<ImTextureRect>     Rects;
+    ImVector<int>               RectsFreeSlots;         // Unused entries in Rects[] (discarded rectangles), reused by ImFontAtlasPackAddRect()
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
     int                         RectsIndexFreeListStart;// First unused entry
     int                         RectsPackedCount;       // Number of packed rectangles.
     int                         RectsPackedSurface;     // Number of packed pixels. Used when compacting to heuristically find the ideal texture size.
-    int                         RectsDiscardedCount;
-    int                         RectsDiscardedSurface;
+    int                         RectsDiscardedCount;    // Number of unused entries in Rects[]
+    int                         RectsDiscardedSurface;  // Number of discarded pixels not reused yet (== total surface of PackFreeRects[] + PackFreeRectsPending[] unless a repack is pending)
     int                         FrameCount;             // Current frame count
     ImVec2i                     MaxRectSize;            // Largest rectangle to pack (de-facto used as a "minimum texture size")
     ImVec2i                     MaxRectBounds;          // Bottom-right most used pixels
     bool                        LockDisableResize;      // Disable resizing texture
+    bool                        PackDefragPending;      // Set when rectangles are discarded: ImFontAtlasUpdateNewFrame() will incrementally compact the texture until no progress is made.
+    bool                        EvictPending;           // Set when growing texture would exceed ImFontAtlas::TexMaxMemorySize: ImFontAtlasUpdateNewFrame() will evict contents not used during the frame.
     bool                        PreloadedAllGlyphsRanges; // Set when missing ImGuiBackendFlags_RendererHasTextures features forces atlas to preload everything.
+    bool                        ReadOnlyForThreads;     // Set by ImFontAtlasSetReadOnlyForThreads(): no glyph loading, no new ImFontBaked, no writes to shared caches.
 
     // Cache of all ImFontBaked
     ImStableVector<ImFontBaked,32> BakedPool;
     ImGuiStorage                BakedMap;               // BakedId --> ImFontBaked*
     int                         BakedDiscardedCount;
+    int                         BakedClearedCount;      // Incremented when glyphs of any ImFontBaked are discarded or replaced, to invalidate caches referring to them (e.g. text layout cache).
+
+    // Asynchronous glyph loading (see ImFontAtlas::RunAsync)
+    ImVector<ImFontAtlasGlyphAsyncRequest> AsyncRequests; // Glyphs requested during the frame. Jobs are started by ImFontAtlasUpdateNewFrame().
+    ImVector<ImFontAtlasGlyphAsyncBatch*> AsyncBatches;   // Jobs in flight, one per ImFontBaked. Results are integrated by ImFontAtlasUpdateNewFrame().
+    bool                        AsyncDisabled;          // Temporarily load glyphs synchronously (e.g. within ImFontAtlasBakedLoadGlyphs()).
+
+    // Statistics, displayed in Metrics/Debugger. Eviction happens when growing texture would exceed ImFontAtlas::TexMaxMemorySize.
+    ImU64                       GlyphsRenderedCount;    // Visible glyphs output by RenderText(), RenderChar(), ImFontRenderTextLayout(). Not counted while ReadOnlyForThreads.
+    int                         GlyphsLoadedCount;      // Glyphs added to any ImFontBaked
+    int                         GlyphsEvictedCount;     // Glyphs discarded by ImFontAtlasBuildEvictLRU()
+    int                         BakedEvictedCount;      // ImFontBaked discarded by ImFontAtlasBuildEvictLRU()
 
     // Custom rectangle identifiers
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
@@ -3858,6 +4109,7 @@ IMGUI_API void              ImFontAtlasBuildRenderBitmapFromString(ImFontAtlas*
 IMGUI_API void              ImFontAtlasBuildClear(ImFontAtlas* atlas); // Clear output and custom rects
 
 IMGUI_API ImTextureData*    ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h);
+IMGUI_API int               ImFontAtlasTextureGetMemorySize(ImFontAtlas* atlas, int w, int h);
 IMGUI_API void              ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h);
 IMGUI_API void              ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_w = -1, int old_h = -1);
@@ -3866,8 +4118,13 @@ IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas
 
 IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
+IMGUI_API void              ImFontAtlasGlyphCacheSaveToMemory(ImFontAtlas* atlas, ImVector<unsigned char>* out_data);  // Save glyphs of all baked fonts (metrics + pixels)
+IMGUI_API bool              ImFontAtlasGlyphCacheLoadFromMemory(ImFontAtlas* atlas, const void* data, size_t data_size); // Load glyphs for matching fonts/sizes. Call after adding fonts.
+IMGUI_API bool              ImFontAtlasGlyphCacheSaveToDisk(ImFontAtlas* atlas, const char* filename);
+IMGUI_API bool              ImFontAtlasGlyphCacheLoadFromDisk(ImFontAtlas* atlas, const char* filename);
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
+IMGUI_API bool              ImFontAtlasBuildEvictLRU(ImFontAtlas* atlas, int surface);
 
 IMGUI_API bool              ImFontAtlasFontSourceInit(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
@@ -3879,18 +4136,25 @@ IMGUI_API void              ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFo
 IMGUI_API ImGuiID           ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
+IMGUI_API void              ImFontAtlasSetReadOnlyForThreads(ImFontAtlas* atlas, bool read_only);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id);
 IMGUI_API void              ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked);
 IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph);
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
+IMGUI_API bool              ImFontAtlasBakedPackFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, const ImFontGlyphBitmap* bitmap);
+IMGUI_API int               ImFontAtlasBakedLoadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, const ImWchar* codepoints, int codepoints_count); // Load many glyphs at once, using ImFontAtlas::ParallelFor when set.
+IMGUI_API void              ImFontAtlasBuildUpdateAsyncGlyphs(ImFontAtlas* atlas);  // Integrate completed asynchronous jobs, start new ones. Called by ImFontAtlasUpdateNewFrame().
+IMGUI_API void              ImFontAtlasBuildDiscardAsyncGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked); // Wait for jobs in flight (all, or for given font/baked) and drop their results. Pending glyphs will be requested again.
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API void              ImFontAtlasPackFlushDiscardedRects(ImFontAtlas* atlas); // Clear pixels of rectangles discarded during last frame and make their space available. Called by ImFontAtlasUpdateNewFrame().
+IMGUI_API bool              ImFontAtlasPackDefrag(ImFontAtlas* atlas, int max_pixels = -1); // Move rectangles into free space above them and give space back to the packer. Return true on progress. Moves pixels in place: only call between frames.
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
 IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
@@ -3908,6 +4172,9 @@ IMGUI_API void              ImFontAtlasTextureBlockQueueUpload(ImFontAtlas* atla
 IMGUI_API int               ImTextureDataGetFormatBytesPerPixel(ImTextureFormat format);
 IMGUI_API const char*       ImTextureDataGetStatusName(ImTextureStatus status);
 IMGUI_API const char*       ImTextureDataGetFormatName(ImTextureFormat format);
+IMGUI_API void              ImTextureDataCreateCompressedPixels(ImTextureData* tex);
+IMGUI_API void              ImTextureDataEncodeCompressedBlocks(ImTextureData* tex, int x, int y, int w, int h);
+IMGUI_API void              ImTextureDataUpdateCompressedPixels(ImTextureData* tex);
 
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 IMGUI_API void              ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas);
@@ -4346,16 +4346,20 @@ void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
     ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0 && backup->IndexPages.Size == 0);
     ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
     g.InputTextPasswordFontBackupFlags = g.Font->Flags;
     backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
     backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
     backup->IndexLookup.swap(g.FontBaked->IndexLookup);
     backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
+    backup->IndexPages.swap(g.FontBaked->IndexPages);
+    memcpy(backup->AsciiGlyphIndex, g.FontBaked->AsciiGlyphIndex, sizeof(backup->AsciiGlyphIndex));
     g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
     g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
     g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
+    for (int n = 0; n < IM_ARRAYSIZE(g.FontBaked->AsciiGlyphIndex); n++) // RenderText() fast path doesn't use IndexLookup[]
+        g.FontBaked->AsciiGlyphIndex[n] = (ImU16)g.FontBaked->FallbackGlyphIndex;
 }
 
 void ImGui::PopPasswordFont()
@@ -4367,7 +4371,9 @@ void ImGui::PopPasswordFont()
     g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
     g.FontBaked->IndexLookup.swap(backup->IndexLookup);
     g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    g.FontBaked->IndexPages.swap(backup->IndexPages);
+    memcpy(g.FontBaked->AsciiGlyphIndex, backup->AsciiGlyphIndex, sizeof(backup->AsciiGlyphIndex));
+    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0 && backup->IndexPages.Size == 0);
 }
 
 // Return false to discard a character.
@@ -5149,28 +5155,24 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (const char* clipboard = GetClipboardText())
             {
-                // Filter pasted buffer
-                const int clipboard_len = (int)ImStrlen(clipboard);
+                // Filter pasted buffer. Filtering may replace characters: output needs up to 4 bytes per input byte, and its length needs to fit in an int.
+                const int clipboard_len = (int)ImMin(ImStrlen(clipboard), (size_t)(INT_MAX - 1) / 4);
                 const char* clipboard_end = clipboard + clipboard_len;
-                ImVector<char> clipboard_filtered;
-                clipboard_filtered.reserve(clipboard_len + 1);
-                for (const char* s = clipboard; *s != 0; )
+                char* clipboard_filtered = (char*)MemAllocFrame((size_t)clipboard_len * 4 + 1);
+                int clipboard_filtered_len = 0;
+                for (const char* s = clipboard; s < clipboard_end; )
                 {
                     unsigned int c;
                     int in_len = ImTextCharFromUtf8(&c, s, clipboard_end);
                     s += in_len;
                     if (!InputTextFilterCharacter(&g, &c, flags, callback, callback_user_data, true))
                         continue;
-                    char c_utf8[5];
-                    ImTextCharToUtf8(c_utf8, c);
-                    int out_len = (int)ImStrlen(c_utf8);
-                    clipboard_filtered.resize(clipboard_filtered.Size + out_len);
-                    memcpy(clipboard_filtered.Data + clipboard_filtered.Size - out_len, c_utf8, out_len);
+                    clipboard_filtered_len += ImTextCharToUtf8(clipboard_filtered + clipboard_filtered_len, c);
                 }
-                if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
+                if (clipboard_filtered_len > 0) // If everything was filtered, ignore the pasting operation
                 {
-                    clipboard_filtered.push_back(0);
-                    stb_textedit_paste(state, state->Stb, clipboard_filtered.Data, clipboard_filtered.Size - 1);
+                    clipboard_filtered[clipboard_filtered_len] = 0;
+                    stb_textedit_paste(state, state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
             }
@@ -8393,6 +8395,7 @@ ImGuiSelectionBasicStorage::ImGuiSelectionBasicStorage()
     UserData = NULL;
     AdapterIndexToStorageId = [](ImGuiSelectionBasicStorage*, int idx) { return (ImGuiID)idx; };
     _SelectionOrder = 1; // Always >0
+    _Storage.SetUseHashIndex(false); // We access sorted _Storage.Data[] directly
 }
 
 void ImGuiSelectionBasicStorage::Clear()
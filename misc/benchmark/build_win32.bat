@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Release
+cl /nologo /Zi /O2 /DNDEBUG /MD /utf-8 /I ..\.. %* *.cpp ..\..\*.cpp /FeRelease/imgui_benchmark.exe /FoRelease/ /link gdi32.lib shell32.lib imm32.lib
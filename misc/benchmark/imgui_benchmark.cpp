@@ -0,0 +1,605 @@
+// dear imgui: headless frame benchmark
+// (compile and link imgui, create context, run scripted workloads headless with NO GRAPHICS OUTPUT, report timings as JSON)
+
+// This is built on the same principle as examples/example_null/: no platform backend, no renderer backend.
+// Each workload runs in its own fresh context for a fixed number of frames, with deterministic inputs,
+// so results can be compared across commits/releases on a machine with no GPU (e.g. a CI runner).
+
+// Usage:
+//   imgui_benchmark [--frames N] [--warmup N] [--workload NAME] [--font FILE.ttf] [--output FILE.json] [--list]
+// Output:
+//   JSON is written to stdout (or to the --output file). Human readable progress is written to stderr.
+//   Timings are reported per phase: NewFrame(), widget submission, EndFrame(), Render() (which includes AddDrawListToDrawDataEx()).
+
+// Changelog:
+// - v0.10: Initial version. Workloads: windows, tables, inputtext, drawlist, text_cjk, demo.
+// - v0.11: Added workloads: storage_sorted, storage_hashed.
+// - v0.12: Added workload: focus.
+
+#include "imgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+// [SECTION] Helpers: timing, allocation counters
+//-----------------------------------------------------------------------------
+
+static double GetTimeMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// All allocations made by Dear ImGui go through those functions, see ImGui::SetAllocatorFunctions().
+struct BenchAllocCounters
+{
+    int     AllocCount;
+    int     FreeCount;
+    size_t  AllocBytes;
+};
+static BenchAllocCounters g_AllocCounters = {};
+
+static void* BenchMalloc(size_t size, void* user_data)
+{
+    IM_UNUSED(user_data);
+    g_AllocCounters.AllocCount++;
+    g_AllocCounters.AllocBytes += size;
+    return malloc(size);
+}
+
+static void BenchFree(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    if (ptr != NULL)
+        g_AllocCounters.FreeCount++;
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Workloads
+//-----------------------------------------------------------------------------
+
+struct BenchContext
+{
+    int         Frame;
+    char*       TextBuffer;         // For 'inputtext' workload
+    size_t      TextBufferSize;
+    bool        Bools[64];
+    float       Floats[64];
+};
+
+typedef void (*BenchFunc)(BenchContext* bench);
+
+struct BenchWorkload
+{
+    const char* Name;
+    const char* Desc;
+    BenchFunc   InitFunc;           // Called once after creating the context (optional)
+    BenchFunc   SubmitFunc;         // Called every frame between NewFrame() and EndFrame()
+    BenchFunc   ShutdownFunc;       // Called once before destroying the context (optional)
+};
+
+// Many top-level windows with a few common widgets each.
+static void Workload_Windows_Submit(BenchContext* bench)
+{
+    const int WINDOWS_COUNT = 200;
+    for (int n = 0; n < WINDOWS_COUNT; n++)
+    {
+        ImGui::SetNextWindowPos(ImVec2((float)((n % 20) * 90), (float)((n / 20) * 100)), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(200, 160), ImGuiCond_Once);
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %03d", n);
+        ImGui::Begin(name);
+        ImGui::Text("Frame %d, window %d", bench->Frame, n);
+        ImGui::Checkbox("Checkbox", &bench->Bools[n % IM_ARRAYSIZE(bench->Bools)]);
+        ImGui::SliderFloat("Slider", &bench->Floats[n % IM_ARRAYSIZE(bench->Floats)], 0.0f, 1.0f);
+        if (ImGui::Button("Button"))
+            bench->Bools[0] = !bench->Bools[0];
+        ImGui::SameLine();
+        ImGui::SmallButton("Small");
+        if (ImGui::TreeNode("Tree"))
+        {
+            ImGui::BulletText("Item A");
+            ImGui::BulletText("Item B");
+            ImGui::TreePop();
+        }
+        ImGui::ProgressBar(fmodf(bench->Frame * 0.01f + n * 0.1f, 1.0f));
+        ImGui::End();
+    }
+}
+
+// Large tables: one fully submitted (no clipper), one large one using ImGuiListClipper.
+static void Workload_Tables_Submit(BenchContext* bench)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("Tables", NULL, ImGuiWindowFlags_NoSavedSettings);
+
+    const int COLUMNS_COUNT = 8;
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("table_full", COLUMNS_COUNT, flags, ImVec2(0.0f, 500.0f)))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        for (int column = 0; column < COLUMNS_COUNT; column++)
+        {
+            char label[16];
+            snprintf(label, IM_ARRAYSIZE(label), "Column %d", column);
+            ImGui::TableSetupColumn(label);
+        }
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 1000; row++)
+        {
+            ImGui::TableNextRow();
+            for (int column = 0; column < COLUMNS_COUNT; column++)
+            {
+                ImGui::TableSetColumnIndex(column);
+                ImGui::Text("Cell %d,%d", row, column);
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    if (ImGui::BeginTable("table_clipped", COLUMNS_COUNT, flags, ImVec2(0.0f, 500.0f)))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        for (int column = 0; column < COLUMNS_COUNT; column++)
+            ImGui::TableSetupColumn(column == 0 ? "ID" : "Value");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(100000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("%06d", row);
+                for (int column = 1; column < COLUMNS_COUNT; column++)
+                {
+                    ImGui::TableSetColumnIndex(column);
+                    ImGui::Text("%.3f", (float)(row * column) * 0.001f);
+                }
+            }
+        ImGui::EndTable();
+    }
+    IM_UNUSED(bench);
+    ImGui::End();
+}
+
+// Long multi-line text buffer, kept active so the editing code path is exercised.
+static void Workload_InputText_Init(BenchContext* bench)
+{
+    const int LINES_COUNT = 20000;
+    bench->TextBufferSize = 1024 * 1024 * 2;
+    bench->TextBuffer = (char*)malloc(bench->TextBufferSize);
+    char* p = bench->TextBuffer;
+    char* p_end = bench->TextBuffer + bench->TextBufferSize - 1;
+    for (int n = 0; n < LINES_COUNT && p < p_end - 128; n++)
+        p += snprintf(p, (size_t)(p_end - p), "%05d: The quick brown fox jumps over the lazy dog. 0123456789 {}[]()\n", n);
+    *p = 0;
+}
+
+static void Workload_InputText_Submit(BenchContext* bench)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("InputText", NULL, ImGuiWindowFlags_NoSavedSettings);
+    if (bench->Frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", bench->TextBuffer, bench->TextBufferSize, ImVec2(-FLT_MIN, 500.0f));
+    ImGui::InputTextMultiline("##text_wrapped", bench->TextBuffer, bench->TextBufferSize, ImVec2(-FLT_MIN, -FLT_MIN), ImGuiInputTextFlags_ReadOnly | ImGuiInputTextFlags_WordWrap);
+    ImGui::End();
+}
+
+static void Workload_InputText_Shutdown(BenchContext* bench)
+{
+    free(bench->TextBuffer);
+    bench->TextBuffer = NULL;
+}
+
+// Dense ImDrawList primitives, typical of plots, graphs and node editors.
+static void Workload_DrawList_Submit(BenchContext* bench)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("DrawList", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p0 = ImGui::GetCursorScreenPos();
+    const float t = bench->Frame * 0.01f;
+
+    // Polylines (plots)
+    const int PLOT_POINTS = 2000;
+    ImVec2 points[PLOT_POINTS];
+    for (int plot_n = 0; plot_n < 8; plot_n++)
+    {
+        for (int n = 0; n < PLOT_POINTS; n++)
+            points[n] = ImVec2(p0.x + n * (1900.0f / PLOT_POINTS), p0.y + 60.0f + plot_n * 40.0f + sinf(t + n * 0.05f + plot_n) * 30.0f);
+        draw_list->AddPolyline(points, PLOT_POINTS, IM_COL32(255, 200 - plot_n * 20, plot_n * 30, 255), ImDrawFlags_None, 1.0f + (plot_n & 1) * 1.5f);
+    }
+
+    // Rectangles (heatmap/grid)
+    for (int y = 0; y < 40; y++)
+        for (int x = 0; x < 160; x++)
+        {
+            ImVec2 r0(p0.x + x * 12.0f, p0.y + 400.0f + y * 8.0f);
+            draw_list->AddRectFilled(r0, ImVec2(r0.x + 11.0f, r0.y + 7.0f), IM_COL32((x * 5) & 255, (y * 9) & 255, ((x + y + bench->Frame) * 3) & 255, 255));
+        }
+
+    // Circles, rounded rectangles and beziers (gauges, nodes)
+    for (int n = 0; n < 400; n++)
+    {
+        ImVec2 c(p0.x + 20.0f + (n % 40) * 47.0f, p0.y + 750.0f + (n / 40) * 30.0f);
+        float radius = 5.0f + (n % 4) * 3.0f;
+        draw_list->AddCircleFilled(c, radius, IM_COL32(100, 200, 100, 255));
+        draw_list->AddCircle(c, radius + 2.0f, IM_COL32(255, 255, 255, 255), 0, 1.5f);
+        draw_list->AddRect(ImVec2(c.x - 20.0f, c.y - 12.0f), ImVec2(c.x + 20.0f, c.y + 12.0f), IM_COL32(200, 200, 255, 255), 4.0f);
+        draw_list->AddBezierCubic(c, ImVec2(c.x + 10.0f, c.y - 20.0f), ImVec2(c.x + 30.0f, c.y + 20.0f), ImVec2(c.x + 47.0f, c.y), IM_COL32(255, 255, 0, 255), 1.0f);
+    }
+
+    // Small text labels
+    for (int n = 0; n < 200; n++)
+        draw_list->AddText(ImVec2(p0.x + (n % 20) * 95.0f, p0.y + 1060.0f - (n / 20) * 14.0f), IM_COL32_WHITE, "Label 0123");
+    ImGui::End();
+}
+
+// CJK text. Without a --font covering CJK glyphs, this measures the fallback path.
+static void Workload_TextCJK_Submit(BenchContext* bench)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("TextCJK", NULL, ImGuiWindowFlags_NoSavedSettings);
+    static const char* lines[] =
+    {
+        "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88 (Japanese text)",                  // 日本語のテキスト
+        "\xe4\xb8\xad\xe6\x96\x87\xe6\x96\x87\xe6\x9c\xac\xe6\xb5\x8b\xe8\xaf\x95 (Chinese text)",                                          // 中文文本测试
+        "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4 \xed\x85\x8d\xec\x8a\xa4\xed\x8a\xb8 (Korean text)",                                          // 한국어 텍스트
+    };
+    for (int n = 0; n < 60; n++)
+        ImGui::Text("%04d %s %s", n, lines[n % IM_ARRAYSIZE(lines)], lines[(n + bench->Frame) % IM_ARRAYSIZE(lines)]);
+    ImGui::PushTextWrapPos(ImGui::GetContentRegionAvail().x * 0.5f);
+    for (int n = 0; n < 10; n++)
+        ImGui::TextWrapped("%s %s %s %s %s %s", lines[0], lines[1], lines[2], lines[0], lines[1], lines[2]);
+    ImGui::PopTextWrapPos();
+    ImGui::End();
+}
+
+// ImGuiStorage: lookups of open state of a large tree, and insertions into a storage filled from scratch every frame
+// (e.g. expanding all nodes of a new tree). Compare sorted pairs (default) and hash index (ImGuiStorage::SetUseHashIndex()).
+static void Workload_Storage_Submit(BenchContext* bench, bool use_hash_index)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1920, 1080));
+    ImGui::Begin("Storage", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::GetStateStorage()->SetUseHashIndex(use_hash_index);
+
+    const int NODES_COUNT = 100;
+    for (int n = 0; n < NODES_COUNT; n++)
+    {
+        ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+        if (ImGui::TreeNode((void*)(intptr_t)n, "Node %d", n))
+        {
+            for (int m = 0; m < NODES_COUNT; m++)
+            {
+                ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+                if (ImGui::TreeNode((void*)(intptr_t)m, "Leaf %d", m))
+                    ImGui::TreePop();
+            }
+            ImGui::TreePop();
+        }
+    }
+
+    const int INSERTIONS_COUNT = 5000;
+    ImGuiStorage storage;
+    storage.SetUseHashIndex(use_hash_index);
+    ImGui::PushID(bench->Frame);
+    for (int n = 0; n < INSERTIONS_COUNT; n++)
+        storage.SetInt(ImGui::GetID(n), n);
+    int sum = 0;
+    for (int n = 0; n < INSERTIONS_COUNT; n++)
+        sum += storage.GetInt(ImGui::GetID(n));
+    ImGui::PopID();
+    ImGui::Text("Sum: %d", sum);
+    ImGui::End();
+}
+static void Workload_StorageSorted_Submit(BenchContext* bench) { Workload_Storage_Submit(bench, false); }
+static void Workload_StorageHashed_Submit(BenchContext* bench) { Workload_Storage_Submit(bench, true); }
+
+// Many child windows, and a different top-level window focused every frame (display/focus order updates, window lookups).
+static void Workload_Focus_Submit(BenchContext* bench)
+{
+    const int WINDOWS_COUNT = 50;
+    const int CHILDREN_COUNT = 100;
+    for (int n = 0; n < WINDOWS_COUNT; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %03d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)((n % 10) * 150), (float)((n / 10) * 150)), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(300, 300), ImGuiCond_Once);
+        if (n == bench->Frame % WINDOWS_COUNT)
+            ImGui::SetNextWindowFocus();
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        for (int m = 0; m < CHILDREN_COUNT; m++)
+        {
+            ImGui::BeginChild(m + 1, ImVec2(0, 20), ImGuiChildFlags_None, ImGuiWindowFlags_NoScrollbar);
+            ImGui::Text("Child %d", m);
+            ImGui::EndChild();
+        }
+        ImGui::End();
+    }
+}
+
+// Demo window, as a general baseline.
+static void Workload_Demo_Submit(BenchContext* bench)
+{
+    IM_UNUSED(bench);
+    ImGui::ShowDemoWindow(NULL);
+}
+
+static const BenchWorkload g_Workloads[] =
+{
+    { "windows",        "200 windows with common widgets",                                  NULL, Workload_Windows_Submit, NULL },
+    { "tables",         "1000 rows table without clipper + 100000 rows table with clipper", NULL, Workload_Tables_Submit, NULL },
+    { "inputtext",      "Active InputTextMultiline() with a 20000 lines buffer",            Workload_InputText_Init, Workload_InputText_Submit, Workload_InputText_Shutdown },
+    { "drawlist",       "Dense ImDrawList primitives (polylines, rects, circles, text)",    NULL, Workload_DrawList_Submit, NULL },
+    { "text_cjk",       "CJK text (use --font to provide a font with CJK glyphs)",          NULL, Workload_TextCJK_Submit, NULL },
+    { "storage_sorted", "ImGuiStorage: 10100 tree nodes + 5000 insertions, sorted pairs",   NULL, Workload_StorageSorted_Submit, NULL },
+    { "storage_hashed", "ImGuiStorage: 10100 tree nodes + 5000 insertions, hash index",     NULL, Workload_StorageHashed_Submit, NULL },
+    { "focus",          "50 windows with 100 child windows each, one focused every frame",  NULL, Workload_Focus_Submit, NULL },
+    { "demo",           "ShowDemoWindow()",                                                 NULL, Workload_Demo_Submit, NULL },
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] Runner
+//-----------------------------------------------------------------------------
+
+enum BenchPhase
+{
+    BenchPhase_NewFrame,
+    BenchPhase_Submit,
+    BenchPhase_EndFrame,
+    BenchPhase_Render,
+    BenchPhase_Total,
+    BenchPhase_COUNT
+};
+static const char* g_PhaseNames[BenchPhase_COUNT] = { "new_frame", "submit", "end_frame", "render", "total" };
+
+struct BenchOptions
+{
+    int         Frames;
+    int         WarmupFrames;
+    const char* WorkloadFilter;
+    const char* FontFilename;
+    const char* OutputFilename;
+};
+
+struct BenchResult
+{
+    ImVector<double>    Timings[BenchPhase_COUNT];  // Per frame, in milliseconds
+    int                 DrawLists;                  // Last frame
+    int                 DrawCmds;                   // Last frame
+    int                 Vertices;                   // Last frame
+    int                 Indices;                    // Last frame
+    BenchAllocCounters  Allocs;                     // Sum over measured frames
+    int                 TexturesCount;
+    int                 TexturesUpdates;            // Sum over measured frames
+
+    BenchResult()       { DrawLists = DrawCmds = Vertices = Indices = 0; memset(&Allocs, 0, sizeof(Allocs)); TexturesCount = TexturesUpdates = 0; }
+    double              GetMean(BenchPhase phase) const { double total = 0.0; for (double t : Timings[phase]) total += t; return Timings[phase].Size ? total / Timings[phase].Size : 0.0; }
+};
+
+// Emulate what a renderer backend does with textures, so we don't get stuck with textures in _WantCreate state.
+// (for simplicity we never read the pixels, we only acknowledge requests)
+static int BenchUpdateTextures(ImDrawData* draw_data)
+{
+    int updates = 0;
+    if (draw_data->Textures == NULL)
+        return 0;
+    for (ImTextureData* tex : *draw_data->Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)tex->UniqueID + 1);
+            tex->SetStatus(ImTextureStatus_OK);
+            updates++;
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetStatus(ImTextureStatus_OK);
+            updates++;
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+            updates++;
+        }
+    }
+    return updates;
+}
+
+static void BenchRunWorkload(const BenchWorkload* workload, const BenchOptions* opts, BenchResult* result)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    if (opts->FontFilename)
+        if (io.Fonts->AddFontFromFileTTF(opts->FontFilename) == NULL)
+            fprintf(stderr, "Failed to load font '%s', using default font.\n", opts->FontFilename);
+
+    BenchContext bench;
+    memset(&bench, 0, sizeof(bench));
+    for (ImVector<double>& timings : result->Timings)
+        timings.reserve(opts->Frames); // Reserve ahead so our own bookkeeping doesn't show up in allocation counters.
+    if (workload->InitFunc)
+        workload->InitFunc(&bench);
+
+    const int total_frames = opts->WarmupFrames + opts->Frames;
+    for (int frame_n = 0; frame_n < total_frames; frame_n++)
+    {
+        const bool measure = (frame_n >= opts->WarmupFrames);
+        bench.Frame = frame_n;
+
+        // Deterministic inputs: mouse slowly circling around the center of the screen.
+        const float a = frame_n * 0.05f;
+        io.AddMousePosEvent(960.0f + cosf(a) * 400.0f, 540.0f + sinf(a) * 300.0f);
+
+        BenchAllocCounters allocs_backup = g_AllocCounters;
+        double t0 = GetTimeMs();
+        ImGui::NewFrame();
+        double t1 = GetTimeMs();
+        workload->SubmitFunc(&bench);
+        double t2 = GetTimeMs();
+        ImGui::EndFrame();
+        double t3 = GetTimeMs();
+        ImGui::Render();
+        double t4 = GetTimeMs();
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        int texture_updates = BenchUpdateTextures(draw_data);
+        if (!measure)
+            continue;
+
+        result->Allocs.AllocCount += g_AllocCounters.AllocCount - allocs_backup.AllocCount;
+        result->Allocs.FreeCount += g_AllocCounters.FreeCount - allocs_backup.FreeCount;
+        result->Allocs.AllocBytes += g_AllocCounters.AllocBytes - allocs_backup.AllocBytes;
+        result->Timings[BenchPhase_NewFrame].push_back(t1 - t0);
+        result->Timings[BenchPhase_Submit].push_back(t2 - t1);
+        result->Timings[BenchPhase_EndFrame].push_back(t3 - t2);
+        result->Timings[BenchPhase_Render].push_back(t4 - t3);
+        result->Timings[BenchPhase_Total].push_back(t4 - t0);
+        result->TexturesUpdates += texture_updates;
+        result->TexturesCount = draw_data->Textures ? draw_data->Textures->Size : 0;
+        result->DrawLists = draw_data->CmdListsCount;
+        result->DrawCmds = 0;
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            result->DrawCmds += draw_list->CmdBuffer.Size;
+        result->Vertices = draw_data->TotalVtxCount;
+        result->Indices = draw_data->TotalIdxCount;
+    }
+
+    if (workload->ShutdownFunc)
+        workload->ShutdownFunc(&bench);
+    ImGui::DestroyContext();
+}
+
+static int BenchCompareDoubles(const void* lhs, const void* rhs)
+{
+    double a = *(const double*)lhs;
+    double b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void BenchWriteJsonTimings(FILE* f, ImVector<double>& timings)
+{
+    double total = 0.0;
+    for (double t : timings)
+        total += t;
+    qsort(timings.Data, (size_t)timings.Size, sizeof(double), BenchCompareDoubles);
+    const int count = timings.Size;
+    const int p95_idx = (int)(count * 0.95);
+    fprintf(f, "{ \"mean\": %.6f, \"min\": %.6f, \"median\": %.6f, \"p95\": %.6f, \"max\": %.6f }",
+        count ? total / count : 0.0,
+        count ? timings[0] : 0.0,
+        count ? timings[count / 2] : 0.0,
+        count ? timings[p95_idx < count ? p95_idx : count - 1] : 0.0,
+        count ? timings[count - 1] : 0.0);
+}
+
+static void BenchWriteJsonResult(FILE* f, const BenchWorkload* workload, BenchResult* result, bool last)
+{
+    const int frames = result->Timings[BenchPhase_Total].Size;
+    fprintf(f, "    {\n");
+    fprintf(f, "      \"name\": \"%s\",\n", workload->Name);
+    fprintf(f, "      \"frames\": %d,\n", frames);
+    fprintf(f, "      \"timings_ms\": {\n");
+    for (int phase = 0; phase < BenchPhase_COUNT; phase++)
+    {
+        fprintf(f, "        \"%s\": ", g_PhaseNames[phase]);
+        BenchWriteJsonTimings(f, result->Timings[phase]);
+        fprintf(f, "%s\n", (phase + 1 < BenchPhase_COUNT) ? "," : "");
+    }
+    fprintf(f, "      },\n");
+    fprintf(f, "      \"draw_data\": { \"draw_lists\": %d, \"draw_cmds\": %d, \"vertices\": %d, \"indices\": %d },\n", result->DrawLists, result->DrawCmds, result->Vertices, result->Indices);
+    fprintf(f, "      \"textures\": { \"count\": %d, \"updates\": %d },\n", result->TexturesCount, result->TexturesUpdates);
+    fprintf(f, "      \"allocations\": { \"allocs\": %d, \"frees\": %d, \"bytes\": %llu, \"allocs_per_frame\": %.2f, \"bytes_per_frame\": %.1f }\n",
+        result->Allocs.AllocCount, result->Allocs.FreeCount, (unsigned long long)result->Allocs.AllocBytes,
+        frames ? (double)result->Allocs.AllocCount / frames : 0.0, frames ? (double)result->Allocs.AllocBytes / frames : 0.0);
+    fprintf(f, "    }%s\n", last ? "" : ",");
+}
+
+static void BenchPrintUsage()
+{
+    fprintf(stderr, "Usage: imgui_benchmark [--frames N] [--warmup N] [--workload NAME] [--font FILE.ttf] [--output FILE.json] [--list]\n");
+    fprintf(stderr, "Workloads:\n");
+    for (const BenchWorkload& workload : g_Workloads)
+        fprintf(stderr, "  %-12s %s\n", workload.Name, workload.Desc);
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(BenchMalloc, BenchFree, NULL);
+
+    BenchOptions opts;
+    opts.Frames = 300;
+    opts.WarmupFrames = 10;
+    opts.WorkloadFilter = NULL;
+    opts.FontFilename = NULL;
+    opts.OutputFilename = NULL;
+    for (int n = 1; n < argc; n++)
+    {
+        const char* arg = argv[n];
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(arg, "--frames") == 0 && has_value)          { opts.Frames = atoi(argv[++n]); if (opts.Frames < 1) opts.Frames = 1; }
+        else if (strcmp(arg, "--warmup") == 0 && has_value)     { opts.WarmupFrames = atoi(argv[++n]); if (opts.WarmupFrames < 0) opts.WarmupFrames = 0; }
+        else if (strcmp(arg, "--workload") == 0 && has_value)   { opts.WorkloadFilter = argv[++n]; }
+        else if (strcmp(arg, "--font") == 0 && has_value)       { opts.FontFilename = argv[++n]; }
+        else if (strcmp(arg, "--output") == 0 && has_value)     { opts.OutputFilename = argv[++n]; }
+        else if (strcmp(arg, "--list") == 0)                    { BenchPrintUsage(); return 0; }
+        else                                                    { BenchPrintUsage(); return 1; }
+    }
+
+    ImVector<const BenchWorkload*> workloads;
+    for (const BenchWorkload& workload : g_Workloads)
+        if (opts.WorkloadFilter == NULL || strcmp(opts.WorkloadFilter, workload.Name) == 0)
+            workloads.push_back(&workload);
+    if (workloads.Size == 0)
+    {
+        fprintf(stderr, "Unknown workload '%s'.\n", opts.WorkloadFilter);
+        BenchPrintUsage();
+        return 1;
+    }
+
+    FILE* f = opts.OutputFilename ? fopen(opts.OutputFilename, "wt") : stdout;
+    if (f == NULL)
+    {
+        fprintf(stderr, "Failed to open '%s' for writing.\n", opts.OutputFilename);
+        return 1;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+    fprintf(f, "  \"imgui_version_num\": %d,\n", IMGUI_VERSION_NUM);
+    fprintf(f, "  \"frames\": %d,\n", opts.Frames);
+    fprintf(f, "  \"warmup_frames\": %d,\n", opts.WarmupFrames);
+    fprintf(f, "  \"workloads\": [\n");
+    for (int n = 0; n < workloads.Size; n++)
+    {
+        fprintf(stderr, "Running '%s' (%d frames)...\n", workloads[n]->Name, opts.Frames);
+        BenchResult result;
+        BenchRunWorkload(workloads[n], &opts, &result);
+        fprintf(stderr, "  %.3f ms/frame (mean), %d vertices, %d draw cmds, %.1f allocs/frame\n",
+            result.GetMean(BenchPhase_Total), result.Vertices, result.DrawCmds, (double)result.Allocs.AllocCount / opts.Frames);
+        BenchWriteJsonResult(f, workloads[n], &result, n + 1 == workloads.Size);
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+    if (f != stdout)
+        fclose(f);
+    return 0;
+}
@@ -0,0 +1,524 @@
+// dear imgui: ImDrawData serializer with frame-to-frame delta encoding, for remote rendering
+// See imgui_drawstream.h for details.
+
+// Frame format (host byte order):
+//  Header:
+//    u32   Magic ('IMDS')
+//    u16   Version
+//    u8    sizeof(ImDrawVert)
+//    u8    sizeof(ImDrawIdx)
+//    u32   Frame index
+//    u8    Flags (1: keyframe)
+//    f32*6 DisplayPos, DisplaySize, FramebufferScale
+//    u32   Number of draw lists
+//  Per draw list:
+//    u8    Op: 0: same as list N of previous frame, 1: delta against list N of previous frame, 2: full
+//    u32   N (Op 0 and 1 only)
+//    (Op 1 and 2 only:)
+//    u32   Vertex count
+//    u32   Number of vertex ranges, then for each range: u32 first, u32 count, count * sizeof(ImDrawVert) bytes
+//    u8    Index size (sizeof(ImDrawIdx), or 4 when using ImDrawList::IdxBuffer32)
+//    u32   Index count
+//    u32   Number of index ranges, then for each range: u32 first, u32 count, count * index size bytes
+//    u8    Commands changed (always 1 for Op 2). If 1:
+//    u32   Command count, then for each command:
+//          f32*4 ClipRect, u8 texture kind, u64 texture value, u32 VtxOffset, u32 IdxOffset, u32 ElemCount, u8 flags (1: ImDrawCallback_ResetRenderState)
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_drawstream.h"
+#include <limits.h>     // INT_MAX
+#include <string.h>     // memcpy, memcmp
+
+#define IM_DRAWSTREAM_MAGIC     0x53444D49  // 'IMDS'
+#define IM_DRAWSTREAM_VERSION   1
+#define IM_DRAWSTREAM_CMD_SIZE  (4 * 4 + 1 + 8 + 4 + 4 + 4 + 1) // Size of an encoded command (38 bytes)
+
+enum ImDrawStreamListOp
+{
+    ImDrawStreamListOp_Same = 0,
+    ImDrawStreamListOp_Delta,
+    ImDrawStreamListOp_Full,
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] Helpers
+//-----------------------------------------------------------------------------
+
+static void WriteBytes(ImVector<unsigned char>* out, const void* data, size_t size)
+{
+    int pos = out->Size;
+    out->resize(pos + (int)size);
+    memcpy(out->Data + pos, data, size);
+}
+static void WriteU8(ImVector<unsigned char>* out, ImU8 v)       { out->push_back(v); }
+static void WriteU16(ImVector<unsigned char>* out, ImU16 v)     { WriteBytes(out, &v, sizeof(v)); }
+static void WriteU32(ImVector<unsigned char>* out, ImU32 v)     { WriteBytes(out, &v, sizeof(v)); }
+static void WriteU64(ImVector<unsigned char>* out, ImU64 v)     { WriteBytes(out, &v, sizeof(v)); }
+static void WriteF32(ImVector<unsigned char>* out, float v)     { WriteBytes(out, &v, sizeof(v)); }
+
+// Bounds-checked reader: any read past the end sets Error and returns zeroes.
+struct ImDrawStreamReader
+{
+    const unsigned char*    Data;
+    const unsigned char*    DataEnd;
+    bool                    Error;
+
+    ImDrawStreamReader(const void* data, size_t size) { Data = (const unsigned char*)data; DataEnd = Data + size; Error = false; }
+    size_t      GetRemainingSize() const { return (size_t)(DataEnd - Data); }
+    const void* ReadBytes(size_t size)
+    {
+        if (Error || (size_t)(DataEnd - Data) < size) { Error = true; return NULL; }
+        const void* p = Data;
+        Data += size;
+        return p;
+    }
+    template<typename T> T Read() { T v; const void* p = ReadBytes(sizeof(T)); if (p) memcpy(&v, p, sizeof(T)); else memset(&v, 0, sizeof(T)); return v; }
+};
+
+// Append changed ranges of 'curr' against 'prev' (elements beyond 'prev_count' are always changed).
+// Blocks of IM_DRAWSTREAM_BLOCK_SIZE elements are compared, consecutive changed blocks are merged into one range.
+static void WriteRanges(ImVector<unsigned char>* out, const void* curr, int curr_count, const void* prev, int prev_count, int elem_size)
+{
+    const int count_pos = out->Size;
+    WriteU32(out, 0);
+    ImU32 ranges_count = 0;
+    const unsigned char* curr_bytes = (const unsigned char*)curr;
+    const unsigned char* prev_bytes = (const unsigned char*)prev;
+    int range_first = -1;
+    for (int block_first = 0; block_first <= curr_count; block_first += IM_DRAWSTREAM_BLOCK_SIZE)
+    {
+        // Last iteration (block_first == curr_count or past last partial block) only flushes pending range
+        const int block_count = (curr_count - block_first < IM_DRAWSTREAM_BLOCK_SIZE) ? curr_count - block_first : IM_DRAWSTREAM_BLOCK_SIZE;
+        const bool changed = (block_count > 0) && ((block_first + block_count > prev_count) || memcmp(curr_bytes + (size_t)block_first * elem_size, prev_bytes + (size_t)block_first * elem_size, (size_t)block_count * elem_size) != 0);
+        if (changed && range_first == -1)
+            range_first = block_first;
+        if (range_first != -1 && (!changed || block_first + block_count >= curr_count))
+        {
+            const int range_end = changed ? block_first + block_count : block_first;
+            WriteU32(out, (ImU32)range_first);
+            WriteU32(out, (ImU32)(range_end - range_first));
+            WriteBytes(out, curr_bytes + (size_t)range_first * elem_size, (size_t)(range_end - range_first) * elem_size);
+            ranges_count++;
+            range_first = -1;
+        }
+        if (block_count <= 0)
+            break;
+    }
+    memcpy(out->Data + count_pos, &ranges_count, sizeof(ranges_count));
+}
+
+// Read ranges into 'dst' (already resized to 'dst_count' elements, and containing previous data)
+static void ReadRanges(ImDrawStreamReader* reader, void* dst, int dst_count, int elem_size)
+{
+    const ImU32 ranges_count = reader->Read<ImU32>();
+    for (ImU32 range_n = 0; range_n < ranges_count && !reader->Error; range_n++)
+    {
+        const ImU32 first = reader->Read<ImU32>();
+        const ImU32 count = reader->Read<ImU32>();
+        if (first > (ImU32)dst_count || count > (ImU32)dst_count - first)
+        {
+            reader->Error = true;
+            return;
+        }
+        if (const void* src = reader->ReadBytes((size_t)count * elem_size))
+            memcpy((unsigned char*)dst + (size_t)first * elem_size, src, (size_t)count * elem_size);
+    }
+}
+
+static void WriteCmds(ImVector<unsigned char>* out, const ImDrawList* draw_list)
+{
+    const int count_pos = out->Size;
+    WriteU32(out, 0);
+    ImU32 cmds_count = 0;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+            continue; // User callbacks can't be transmitted
+        WriteF32(out, cmd.ClipRect.x);
+        WriteF32(out, cmd.ClipRect.y);
+        WriteF32(out, cmd.ClipRect.z);
+        WriteF32(out, cmd.ClipRect.w);
+        ImTextureData* tex_data = cmd.TexRef._TexData;
+        if (tex_data != NULL && tex_data->TexID == ImTextureID_Invalid)
+        {
+            WriteU8(out, (ImU8)ImDrawStreamTexKind_TexDataUniqueID);
+            WriteU64(out, (ImU64)tex_data->UniqueID);
+        }
+        else
+        {
+            WriteU8(out, (ImU8)ImDrawStreamTexKind_TexID);
+            WriteU64(out, (ImU64)cmd.GetTexID());
+        }
+        WriteU32(out, cmd.VtxOffset);
+        WriteU32(out, cmd.IdxOffset);
+        WriteU32(out, cmd.ElemCount);
+        WriteU8(out, cmd.UserCallback == ImDrawCallback_ResetRenderState ? 1 : 0);
+        cmds_count++;
+    }
+    memcpy(out->Data + count_pos, &cmds_count, sizeof(cmds_count));
+}
+
+// Check that commands reference existing indices, and that indices reference existing vertices.
+template<typename T>
+static bool ValidateIndices(const T* idx_buffer, const ImDrawCmd& cmd, ImU32 vtx_count)
+{
+    const ImU32 max_idx = vtx_count - cmd.VtxOffset; // Indices are relative to VtxOffset
+    for (const T* p = idx_buffer + cmd.IdxOffset, *p_end = p + cmd.ElemCount; p < p_end; p++)
+        if ((ImU32)*p >= max_idx)
+            return false;
+    return true;
+}
+
+static bool ValidateDrawList(const ImDrawList* draw_list)
+{
+    const ImU32 vtx_count = (ImU32)draw_list->VtxBuffer.Size;
+    const ImU32 idx_count = (ImU32)draw_list->GetIdxCount();
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.IdxOffset > idx_count || cmd.ElemCount > idx_count - cmd.IdxOffset || cmd.VtxOffset > vtx_count)
+            return false;
+        const bool valid = (draw_list->IdxBuffer32.Size > 0) ? ValidateIndices(draw_list->IdxBuffer32.Data, cmd, vtx_count) : ValidateIndices(draw_list->IdxBuffer.Data, cmd, vtx_count);
+        if (!valid)
+            return false;
+    }
+    return true;
+}
+
+static ImTextureRef DefaultResolveTexRef(ImDrawStreamTexKind kind, ImU64 value, void* user_data)
+{
+    IM_UNUSED(kind);
+    IM_UNUSED(user_data);
+    return ImTextureRef((ImTextureID)value);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawStreamEncoder
+//-----------------------------------------------------------------------------
+
+ImDrawStreamEncoder::ImDrawStreamEncoder()
+{
+    FrameCount = LastFrameSize = LastFullSize = 0;
+}
+
+ImDrawStreamEncoder::~ImDrawStreamEncoder()
+{
+    Clear();
+    for (ListState* list : FreeLists)
+        IM_DELETE(list);
+    FreeLists.clear();
+}
+
+void ImDrawStreamEncoder::Clear()
+{
+    for (ListState* list : PrevLists)
+        FreeLists.push_back(list);
+    PrevLists.resize(0);
+}
+
+void ImDrawStreamEncoder::EncodeFrame(const ImDrawData* draw_data, ImVector<unsigned char>* out_data, bool keyframe)
+{
+    IM_ASSERT(draw_data != NULL && out_data != NULL);
+    if (keyframe)
+        Clear();
+    keyframe = (PrevLists.Size == 0);
+
+    ImVector<unsigned char>* out = out_data;
+    out->resize(0);
+    WriteU32(out, IM_DRAWSTREAM_MAGIC);
+    WriteU16(out, IM_DRAWSTREAM_VERSION);
+    WriteU8(out, (ImU8)sizeof(ImDrawVert));
+    WriteU8(out, (ImU8)sizeof(ImDrawIdx));
+    WriteU32(out, (ImU32)FrameCount);
+    WriteU8(out, keyframe ? 1 : 0);
+    WriteF32(out, draw_data->DisplayPos.x);
+    WriteF32(out, draw_data->DisplayPos.y);
+    WriteF32(out, draw_data->DisplaySize.x);
+    WriteF32(out, draw_data->DisplaySize.y);
+    WriteF32(out, draw_data->FramebufferScale.x);
+    WriteF32(out, draw_data->FramebufferScale.y);
+    WriteU32(out, (ImU32)draw_data->CmdLists.Size);
+
+    int full_size = out->Size;
+    CurrLists.resize(0);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        const int idx_size = draw_list->GetIdxSize();
+        const int idx_count = draw_list->GetIdxCount();
+        TempCmdData.resize(0);
+        WriteCmds(&TempCmdData, draw_list);
+        full_size += 1 + 4 + 4 + 8 + draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert) + 1 + 4 + 4 + 8 + idx_count * idx_size + 1 + TempCmdData.Size;
+
+        // Find same list in previous frame. Since lists are generally submitted in a similar order, start from same index.
+        int prev_idx = -1;
+        for (int n = 0; n < PrevLists.Size && prev_idx == -1; n++)
+        {
+            const int prev_n = (CurrLists.Size + n) % PrevLists.Size;
+            if (PrevLists[prev_n] != NULL && PrevLists[prev_n]->Owner == draw_list)
+                prev_idx = prev_n;
+        }
+        ListState* prev = (prev_idx != -1) ? PrevLists[prev_idx] : NULL;
+        if (prev)
+            PrevLists[prev_idx] = NULL;
+
+        const bool vtx_same = prev && prev->VtxBuffer.Size == draw_list->VtxBuffer.Size && memcmp(prev->VtxBuffer.Data, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes()) == 0;
+        const bool idx_same = prev && prev->IdxSize == idx_size && prev->IdxBuffer.Size == idx_count * idx_size && memcmp(prev->IdxBuffer.Data, draw_list->GetIdxData(), (size_t)prev->IdxBuffer.Size) == 0;
+        const bool cmds_same = prev && prev->CmdData.Size == TempCmdData.Size && memcmp(prev->CmdData.Data, TempCmdData.Data, (size_t)TempCmdData.Size) == 0;
+        if (vtx_same && idx_same && cmds_same)
+        {
+            WriteU8(out, ImDrawStreamListOp_Same);
+            WriteU32(out, (ImU32)prev_idx);
+            CurrLists.push_back(prev);
+            continue;
+        }
+
+        // Write vertices, indices, commands
+        WriteU8(out, prev ? ImDrawStreamListOp_Delta : ImDrawStreamListOp_Full);
+        if (prev)
+            WriteU32(out, (ImU32)prev_idx);
+        WriteU32(out, (ImU32)draw_list->VtxBuffer.Size);
+        WriteRanges(out, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size, prev ? prev->VtxBuffer.Data : NULL, prev ? prev->VtxBuffer.Size : 0, (int)sizeof(ImDrawVert));
+        const bool idx_size_same = prev && prev->IdxSize == idx_size;
+        WriteU8(out, (ImU8)idx_size);
+        WriteU32(out, (ImU32)idx_count);
+        WriteRanges(out, draw_list->GetIdxData(), idx_count, idx_size_same ? prev->IdxBuffer.Data : NULL, idx_size_same ? prev->IdxBuffer.Size / idx_size : 0, idx_size);
+        WriteU8(out, cmds_same ? 0 : 1);
+        if (!cmds_same)
+            WriteBytes(out, TempCmdData.Data, (size_t)TempCmdData.Size);
+
+        // Store state for next frame
+        ListState* curr = prev;
+        if (curr == NULL)
+        {
+            if (FreeLists.Size > 0)
+            {
+                curr = FreeLists.back();
+                FreeLists.pop_back();
+            }
+            else
+            {
+                curr = IM_NEW(ListState)();
+            }
+        }
+        curr->Owner = draw_list;
+        curr->VtxBuffer.resize(draw_list->VtxBuffer.Size);
+        if (draw_list->VtxBuffer.Size > 0)
+            memcpy(curr->VtxBuffer.Data, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+        curr->IdxSize = idx_size;
+        curr->IdxBuffer.resize(idx_count * idx_size);
+        if (idx_count > 0)
+            memcpy(curr->IdxBuffer.Data, draw_list->GetIdxData(), (size_t)(idx_count * idx_size));
+        curr->CmdData.swap(TempCmdData);
+        CurrLists.push_back(curr);
+    }
+
+    // Recycle lists which disappeared
+    for (ListState* list : PrevLists)
+        if (list != NULL)
+            FreeLists.push_back(list);
+    PrevLists.swap(CurrLists);
+    CurrLists.resize(0);
+
+    FrameCount++;
+    LastFrameSize = out->Size;
+    LastFullSize = full_size;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawStreamDecoder
+//-----------------------------------------------------------------------------
+
+ImDrawStreamDecoder::ImDrawStreamDecoder()
+{
+    FrameCount = 0;
+    ResolveTexRef = NULL;
+    ResolveTexRefUserData = NULL;
+}
+
+ImDrawStreamDecoder::~ImDrawStreamDecoder()
+{
+    Clear();
+    for (ImDrawList* draw_list : FreeLists)
+        IM_DELETE(draw_list);
+    FreeLists.clear();
+}
+
+void ImDrawStreamDecoder::Clear()
+{
+    for (ImDrawList* draw_list : PrevLists)
+        FreeLists.push_back(draw_list);
+    PrevLists.resize(0);
+    DrawData.Clear();
+}
+
+bool ImDrawStreamDecoder::DecodeFrame(const void* data, size_t data_size)
+{
+    ImDrawStreamReader reader(data, data_size);
+    const ImU32 magic = reader.Read<ImU32>();
+    const ImU16 version = reader.Read<ImU16>();
+    const ImU8 vtx_size = reader.Read<ImU8>();
+    const ImU8 idx_size_default = reader.Read<ImU8>();
+    const ImU32 frame_index = reader.Read<ImU32>();
+    const ImU8 flags = reader.Read<ImU8>();
+    const bool keyframe = (flags & 1) != 0;
+    if (reader.Error || magic != IM_DRAWSTREAM_MAGIC || version != IM_DRAWSTREAM_VERSION || vtx_size != sizeof(ImDrawVert) || idx_size_default != sizeof(ImDrawIdx))
+        return false;
+    if (!keyframe && (DrawData.Valid == false || frame_index != (ImU32)FrameCount))
+        return false; // Missing previous frame
+    if (keyframe)
+        Clear();
+
+    ImVec2 display_pos, display_size, framebuffer_scale;
+    display_pos.x = reader.Read<float>();
+    display_pos.y = reader.Read<float>();
+    display_size.x = reader.Read<float>();
+    display_size.y = reader.Read<float>();
+    framebuffer_scale.x = reader.Read<float>();
+    framebuffer_scale.y = reader.Read<float>();
+    const ImU32 lists_count = reader.Read<ImU32>();
+
+    // Prev lists are moved to new frame as they get referenced (at most once), remaining ones are recycled at the end.
+    ImVector<ImDrawList*>& curr_lists = DrawData.CmdLists;
+    curr_lists.resize(0);
+    for (ImU32 list_n = 0; list_n < lists_count && !reader.Error; list_n++)
+    {
+        const ImU8 op = reader.Read<ImU8>();
+        ImDrawList* draw_list = NULL;
+        if (op == ImDrawStreamListOp_Same || op == ImDrawStreamListOp_Delta)
+        {
+            const ImU32 prev_idx = reader.Read<ImU32>();
+            if (prev_idx >= (ImU32)PrevLists.Size || PrevLists[prev_idx] == NULL)
+            {
+                reader.Error = true;
+                break;
+            }
+            draw_list = PrevLists[prev_idx];
+            PrevLists[prev_idx] = NULL;
+        }
+        else if (op == ImDrawStreamListOp_Full)
+        {
+            if (FreeLists.Size > 0)
+            {
+                draw_list = FreeLists.back();
+                FreeLists.pop_back();
+            }
+            else
+            {
+                draw_list = IM_NEW(ImDrawList)(NULL);
+            }
+            draw_list->VtxBuffer.resize(0);
+            draw_list->IdxBuffer.resize(0);
+            draw_list->IdxBuffer32.resize(0);
+            draw_list->CmdBuffer.resize(0);
+        }
+        else
+        {
+            reader.Error = true;
+            break;
+        }
+        curr_lists.push_back(draw_list);
+        if (op == ImDrawStreamListOp_Same)
+            continue;
+
+        // Vertices
+        const ImU32 vtx_count = reader.Read<ImU32>();
+        if (vtx_count > (ImU32)(INT_MAX / sizeof(ImDrawVert)))
+            reader.Error = true;
+        if (reader.Error)
+            break;
+        draw_list->VtxBuffer.resize((int)vtx_count);
+        ReadRanges(&reader, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size, (int)sizeof(ImDrawVert));
+
+        // Indices
+        const ImU8 idx_size = reader.Read<ImU8>();
+        const ImU32 idx_count = reader.Read<ImU32>();
+        if ((idx_size != sizeof(ImDrawIdx) && idx_size != sizeof(ImU32)) || idx_count > (ImU32)(INT_MAX / sizeof(ImU32)))
+            reader.Error = true;
+        if (reader.Error)
+            break;
+        if (idx_size == sizeof(ImDrawIdx))
+        {
+            draw_list->IdxBuffer32.resize(0);
+            draw_list->IdxBuffer.resize((int)idx_count);
+            ReadRanges(&reader, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size, idx_size);
+        }
+        else
+        {
+            draw_list->IdxBuffer.resize(0);
+            draw_list->IdxBuffer32.resize((int)idx_count);
+            ReadRanges(&reader, draw_list->IdxBuffer32.Data, draw_list->IdxBuffer32.Size, idx_size);
+        }
+
+        // Commands
+        const bool cmds_changed = reader.Read<ImU8>() != 0;
+        if (op == ImDrawStreamListOp_Full && !cmds_changed)
+            reader.Error = true;
+        if (reader.Error)
+            break;
+        if (cmds_changed)
+        {
+            const ImU32 cmds_count = reader.Read<ImU32>();
+            if (cmds_count > (ImU32)(reader.GetRemainingSize() / IM_DRAWSTREAM_CMD_SIZE))
+                reader.Error = true;
+            if (reader.Error)
+                break;
+            draw_list->CmdBuffer.resize((int)cmds_count);
+            for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+            {
+                cmd = ImDrawCmd();
+                cmd.ClipRect.x = reader.Read<float>();
+                cmd.ClipRect.y = reader.Read<float>();
+                cmd.ClipRect.z = reader.Read<float>();
+                cmd.ClipRect.w = reader.Read<float>();
+                const ImDrawStreamTexKind tex_kind = (ImDrawStreamTexKind)reader.Read<ImU8>();
+                const ImU64 tex_value = reader.Read<ImU64>();
+                cmd.TexRef = ResolveTexRef ? ResolveTexRef(tex_kind, tex_value, ResolveTexRefUserData) : DefaultResolveTexRef(tex_kind, tex_value, NULL);
+                cmd.VtxOffset = reader.Read<ImU32>();
+                cmd.IdxOffset = reader.Read<ImU32>();
+                cmd.ElemCount = reader.Read<ImU32>();
+                cmd.UserCallback = (reader.Read<ImU8>() & 1) ? ImDrawCallback_ResetRenderState : NULL;
+                cmd.UserCallbackDataOffset = -1;
+            }
+        }
+
+        // Validate commands and indices so a malformed stream can't make a renderer backend read out of bounds.
+        // Done for every list which changed, even when its commands didn't, since vertices and indices may have.
+        if (!ValidateDrawList(draw_list))
+            reader.Error = true;
+    }
+
+    // Recycle lists which disappeared
+    for (ImDrawList* draw_list : PrevLists)
+        if (draw_list != NULL)
+            FreeLists.push_back(draw_list);
+    PrevLists.resize(0);
+
+    if (reader.Error)
+    {
+        // Lists referenced by the malformed frame are in an undefined state: discard everything, a keyframe is needed.
+        for (ImDrawList* draw_list : curr_lists)
+            FreeLists.push_back(draw_list);
+        DrawData.Clear();
+        FrameCount = 0;
+        return false;
+    }
+
+    PrevLists = curr_lists;
+    DrawData.Valid = true;
+    DrawData.CmdListsCount = curr_lists.Size;
+    DrawData.TotalVtxCount = DrawData.TotalIdxCount = 0;
+    for (ImDrawList* draw_list : curr_lists)
+    {
+        DrawData.TotalVtxCount += draw_list->VtxBuffer.Size;
+        DrawData.TotalIdxCount += draw_list->GetIdxCount();
+    }
+    DrawData.DisplayPos = display_pos;
+    DrawData.DisplaySize = display_size;
+    DrawData.FramebufferScale = framebuffer_scale;
+    DrawData.OwnerViewport = NULL;
+    DrawData.Textures = NULL;
+    FrameCount = (int)frame_index + 1;
+    return true;
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,104 @@
+// dear imgui: ImDrawData serializer with frame-to-frame delta encoding, for remote rendering
+// (run Dear ImGui on a headless server, stream draw data to thin clients which render it with a regular renderer backend)
+
+// Changelog:
+// - v0.10: Initial version. ImDrawStreamEncoder / ImDrawStreamDecoder.
+// - v0.11: Decoder checks indices against vertex count, for every changed list. Fixed size of encoded commands in sanity check.
+
+// Usage:
+//  Server:
+//    ImDrawStreamEncoder encoder;
+//    ImVector<unsigned char> packet;
+//    [...]
+//    ImGui::Render();
+//    encoder.EncodeFrame(ImGui::GetDrawData(), &packet);   // Set 'keyframe=true' e.g. when a new client connects.
+//    MySend(packet.Data, packet.Size);
+//  Client:
+//    ImDrawStreamDecoder decoder;
+//    [...]
+//    if (decoder.DecodeFrame(data, data_size))
+//        ImGui_ImplXXXX_RenderDrawData(decoder.GetDrawData());
+//    else
+//        MyRequestKeyframe();                              // Malformed packet or missing previous frame.
+
+// Notes:
+// - Frames are delta-encoded against the previous frame: draw lists are matched by their ImDrawList* address
+//   on the server (e.g. a window keeps its draw list across frames), then:
+//   - a list identical to its previous version is sent as a reference to it (a few bytes).
+//   - otherwise, only the ranges of vertices/indices which changed are sent, and the command buffer is sent
+//     only if it changed. Ranges are detected per block of IM_DRAWSTREAM_BLOCK_SIZE elements.
+// - The decoder MUST receive every frame, in order, since the previous one. Frames are numbered, DecodeFrame()
+//   returns false on a gap or malformed data: request a keyframe (encoded with keyframe=true) in that case.
+// - Data is written in host byte order, and sizeof(ImDrawVert)/sizeof(ImDrawIdx) must match between server and
+//   client (they are checked by the decoder). Use e.g. IMGUI_USE_COMPACT_DRAWVERT on both ends to halve vertex data.
+// - Textures are not transmitted, only their identifiers: ImDrawCmd::GetTexID() when valid, otherwise the
+//   ImTextureData::UniqueID of a texture which hasn't been created by a renderer backend (the typical case on a
+//   headless server). Set ImDrawStreamDecoder::ResolveTexRef to map them to textures on the client. You are
+//   responsible for sending texture contents (e.g. ImGui::GetPlatformIO().Textures[] updates) over your own channel.
+// - User callbacks can't be transmitted, except ImDrawCallback_ResetRenderState: other callbacks are dropped.
+// - The decoder checks that commands of every list which changed reference existing indices, and that those indices
+//   reference existing vertices, so a malformed frame can't make a renderer backend read out of bounds.
+// - See misc/tests/imgui_tests.cpp for a round-trip test.
+
+#pragma once
+
+#ifndef IMGUI_DISABLE
+
+#ifndef IM_DRAWSTREAM_BLOCK_SIZE
+#define IM_DRAWSTREAM_BLOCK_SIZE    32      // Vertices/indices are compared and sent by blocks of that many elements.
+#endif
+
+// Kind of texture identifier stored in a stream, passed to ImDrawStreamDecoder::ResolveTexRef.
+enum ImDrawStreamTexKind
+{
+    ImDrawStreamTexKind_TexID = 0,          // Value is a ImTextureID (ImDrawCmd::GetTexID() on the server)
+    ImDrawStreamTexKind_TexDataUniqueID,    // Value is a ImTextureData::UniqueID (texture had no ImTextureID yet on the server)
+};
+
+// Server side: serialize a ImDrawData into a binary frame, delta-encoded against the previous call.
+struct ImDrawStreamEncoder
+{
+    int                         FrameCount;     // Number of frames encoded so far
+    int                         LastFrameSize;  // Size in bytes of last encoded frame
+    int                         LastFullSize;   // Size in bytes that last frame would have taken without delta encoding (for stats)
+
+    // [Internal]
+    struct ListState
+    {
+        const ImDrawList*       Owner;          // Server ImDrawList* (only used as an identifier)
+        ImVector<ImDrawVert>    VtxBuffer;
+        ImVector<unsigned char> IdxBuffer;      // Raw indices (ImDrawIdx or ImU32)
+        ImVector<unsigned char> CmdData;        // Serialized commands
+        int                     IdxSize;        // 2 or 4
+    };
+    ImVector<ListState*>        PrevLists;      // Lists of previous frame
+    ImVector<ListState*>        CurrLists;
+    ImVector<ListState*>        FreeLists;
+    ImVector<unsigned char>     TempCmdData;
+
+    IMGUI_API ImDrawStreamEncoder();
+    IMGUI_API ~ImDrawStreamEncoder();
+    IMGUI_API void  Clear();                    // Forget previous frame: next frame will be a keyframe.
+    IMGUI_API void  EncodeFrame(const ImDrawData* draw_data, ImVector<unsigned char>* out_data, bool keyframe = false);
+};
+
+// Client side: rebuild a ImDrawData from frames produced by ImDrawStreamEncoder.
+struct ImDrawStreamDecoder
+{
+    ImDrawData                  DrawData;       // Output. ImDrawList are owned by the decoder and recycled across frames.
+    int                         FrameCount;     // Index of last decoded frame + 1
+    ImTextureRef              (*ResolveTexRef)(ImDrawStreamTexKind kind, ImU64 value, void* user_data);  // Optional: map a texture identifier to a texture. Default: ImTextureRef((ImTextureID)value).
+    void*                       ResolveTexRefUserData;
+
+    // [Internal]
+    ImVector<ImDrawList*>       PrevLists;
+    ImVector<ImDrawList*>       FreeLists;
+
+    IMGUI_API ImDrawStreamDecoder();
+    IMGUI_API ~ImDrawStreamDecoder();
+    IMGUI_API void          Clear();            // Forget previous frame: next frame needs to be a keyframe.
+    IMGUI_API bool          DecodeFrame(const void* data, size_t data_size);   // Return false on malformed data or missing previous frame. DrawData is invalid until next keyframe.
+    ImDrawData*             GetDrawData()       { return DrawData.Valid ? &DrawData : NULL; }
+};
+
+#endif // #ifndef IMGUI_DISABLE
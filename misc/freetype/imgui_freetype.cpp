@@ -7,6 +7,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026/10/18: added support for ImFontAtlasFlags_DistanceField using FT_RENDER_MODE_SDF (requires FreeType 2.11+).
+//  2026/10/18: added FontBakedRasterizeGlyph() and per-thread FT_Face for parallel glyph rasterization with ImFontAtlasBakedLoadGlyphs().
 //  2025/06/11: refactored for the new ImFontLoader architecture, and ImGuiBackendFlags_RendererHasTextures support.
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
@@ -49,6 +51,9 @@
 #include FT_SIZES_H             // <freetype/ftsizes.h>
 #include FT_SYNTHESIS_H         // <freetype/ftsynth.h>
 
+// FreeType version as a single number, e.g. 21100 for 2.11.0 (comparing FREETYPE_MINOR alone would fail for 3.x)
+#define IMGUI_FREETYPE_VERSION  (FREETYPE_MAJOR * 10000 + FREETYPE_MINOR * 100 + FREETYPE_PATCH)
+
 // Handle LunaSVG and PlutoSVG
 #if defined(IMGUI_ENABLE_FREETYPE_LUNASVG) && defined(IMGUI_ENABLE_FREETYPE_PLUTOSVG)
 #error "Cannot enable both IMGUI_ENABLE_FREETYPE_LUNASVG and IMGUI_ENABLE_FREETYPE_PLUTOSVG"
@@ -62,7 +67,7 @@
 #include <plutosvg.h>
 #endif
 #if defined(IMGUI_ENABLE_FREETYPE_LUNASVG) || defined (IMGUI_ENABLE_FREETYPE_PLUTOSVG)
-#if !((FREETYPE_MAJOR >= 2) && (FREETYPE_MINOR >= 12))
+#if IMGUI_FREETYPE_VERSION < 21200
 #error IMGUI_ENABLE_FREETYPE_PLUTOSVG or IMGUI_ENABLE_FREETYPE_LUNASVG requires FreeType version >= 2.12
 #endif
 #endif
@@ -146,6 +151,7 @@ struct ImGui_ImplFreeType_Data
 {
     FT_Library                      Library;
     FT_MemoryRec_                   MemoryManager;
+    int                             DistanceFieldSpread;    // Value of "sdf" module "spread" property set on Library (0: not set). See ImGui_ImplFreeType_SetDistanceFieldSpread().
     ImGui_ImplFreeType_Data()       { memset((void*)this, 0, sizeof(*this)); }
 };
 
@@ -163,6 +169,7 @@ struct ImGui_ImplFreeType_FontSrcData
     ImGuiFreeTypeLoaderFlags        UserFlags;          // = ImFontConfig::FontLoaderFlags
     FT_Int32                        LoadFlags;
     ImFontBaked*                    BakedLastActivated;
+    ImVector<FT_Face>               ThreadFacesPool;    // Faces released by jobs, reused by next jobs (see ImGui_ImplFreeType_FontBakedThreadInit())
 };
 
 // Stored in ImFontBaked::FontLoaderDatas: pointer to SourcesCount instances of this. ALLOCATED BY CORE.
@@ -172,6 +179,16 @@ struct ImGui_ImplFreeType_FontSrcBakedData
     ImGui_ImplFreeType_FontSrcBakedData() { memset((void*)this, 0, sizeof(*this)); }
 };
 
+// Stored in per-job buffers by ImFontAtlasBakedLoadGlyphs(). ALLOCATED BY CORE.
+// A FT_Face can't be used from multiple threads at the same time, so each job uses its own FT_Face + FT_Size.
+// The FT_Face is taken from ImGui_ImplFreeType_FontSrcData::ThreadFacesPool and returned to it when the job is destroyed.
+struct ImGui_ImplFreeType_FontSrcThreadData
+{
+    FT_Face     FtFace;
+    FT_Size     FtSize;
+    ImGui_ImplFreeType_FontSrcThreadData() { memset((void*)this, 0, sizeof(*this)); }
+};
+
 bool ImGui_ImplFreeType_FontSrcData::InitFont(FT_Library ft_library, ImFontConfig* src, ImGuiFreeTypeLoaderFlags extra_font_loader_flags)
 {
     FT_Error error = FT_New_Memory_Face(ft_library, (uint8_t*)src->FontData, (FT_Long)src->FontDataSize, (FT_Long)src->FontNo, &FtFace);
@@ -217,11 +234,14 @@ void ImGui_ImplFreeType_FontSrcData::CloseFont()
         FT_Done_Face(FtFace);
         FtFace = nullptr;
     }
+    for (FT_Face thread_face : ThreadFacesPool)
+        FT_Done_Face(thread_face);
+    ThreadFacesPool.clear();
 }
 
-static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_FontSrcData* src_data, uint32_t codepoint)
+static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_FontSrcData* src_data, FT_Face face, uint32_t codepoint)
 {
-    uint32_t glyph_index = FT_Get_Char_Index(src_data->FtFace, codepoint);
+    uint32_t glyph_index = FT_Get_Char_Index(face, codepoint);
     if (glyph_index == 0)
         return nullptr;
 
@@ -230,16 +250,16 @@ static const FT_Glyph_Metrics* ImGui_ImplFreeType_LoadGlyph(ImGui_ImplFreeType_F
     // - https://github.com/ocornut/imgui/issues/4567
     // - https://github.com/ocornut/imgui/issues/4566
     // You can use FreeType 2.10, or the patched version of 2.11.0 in VcPkg, or probably any upcoming FreeType version.
-    FT_Error error = FT_Load_Glyph(src_data->FtFace, glyph_index, src_data->LoadFlags);
+    FT_Error error = FT_Load_Glyph(face, glyph_index, src_data->LoadFlags);
     if (error)
         return nullptr;
 
     // Need an outline for this to work
-    FT_GlyphSlot slot = src_data->FtFace->glyph;
+    FT_GlyphSlot slot = face->glyph;
 #if defined(IMGUI_ENABLE_FREETYPE_LUNASVG) || defined(IMGUI_ENABLE_FREETYPE_PLUTOSVG)
     IM_ASSERT(slot->format == FT_GLYPH_FORMAT_OUTLINE || slot->format == FT_GLYPH_FORMAT_BITMAP || slot->format == FT_GLYPH_FORMAT_SVG);
 #else
-#if ((FREETYPE_MAJOR >= 2) && (FREETYPE_MINOR >= 12))
+#if IMGUI_FREETYPE_VERSION >= 21200
     IM_ASSERT(slot->format != FT_GLYPH_FORMAT_SVG && "The font contains SVG glyphs, you'll need to enable IMGUI_ENABLE_FREETYPE_PLUTOSVG or IMGUI_ENABLE_FREETYPE_LUNASVG in imconfig.h and install required libraries in order to use this font");
 #endif
     IM_ASSERT(slot->format == FT_GLYPH_FORMAT_OUTLINE || slot->format == FT_GLYPH_FORMAT_BITMAP);
@@ -344,6 +364,22 @@ static void* FreeType_Realloc(FT_Memory /*memory*/, long cur_size, long new_size
     return block;
 }
 
+// Distance field spread is a property of the "sdf" module, shared by all faces of our FT_Library (including faces used by loading jobs).
+// Set on loader init, and again only if ImFontAtlas::DistanceFieldSpread was changed afterwards: never while other threads may be rendering glyphs.
+static void ImGui_ImplFreeType_SetDistanceFieldSpread(ImFontAtlas* atlas, ImGui_ImplFreeType_Data* bd)
+{
+#if IMGUI_FREETYPE_VERSION >= 21100
+    if (!(atlas->Flags & ImFontAtlasFlags_DistanceField) || bd->DistanceFieldSpread == atlas->DistanceFieldSpread)
+        return;
+    FT_Int spread = (FT_Int)atlas->DistanceFieldSpread;
+    FT_Property_Set(bd->Library, "sdf", "spread", &spread);
+    bd->DistanceFieldSpread = atlas->DistanceFieldSpread;
+#else
+    IM_UNUSED(atlas);
+    IM_UNUSED(bd);
+#endif
+}
+
 static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->FontLoaderData == nullptr);
@@ -377,6 +413,7 @@ static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
     // With plutosvg, use provided hooks
     FT_Property_Set(bd->Library, "ot-svg", "svg-hooks", plutosvg_ft_svg_hooks());
 #endif // IMGUI_ENABLE_FREETYPE_PLUTOSVG
+    ImGui_ImplFreeType_SetDistanceFieldSpread(atlas, bd);
 
     // Store our data
     atlas->FontLoaderData = (void*)bd;
@@ -418,24 +455,13 @@ static void ImGui_ImplFreeType_FontSrcDestroy(ImFontAtlas* atlas, ImFontConfig*
     src->FontLoaderData = nullptr;
 }
 
-static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src)
+// Request size for a (source + baked) combination on the FT_Size currently activated for 'face'.
+static void ImGui_ImplFreeType_RequestSize(ImGui_ImplFreeType_FontSrcData* bd_font_data, FT_Face face, ImFontConfig* src, ImFontBaked* baked)
 {
-    IM_UNUSED(atlas);
     float size = baked->Size;
     if (src->MergeMode && src->SizePixels != 0.0f)
         size *= (src->SizePixels / baked->OwnerFont->Sources[0]->SizePixels);
 
-    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    bd_font_data->BakedLastActivated = baked;
-
-    // We use one FT_Size per (source + baked) combination.
-    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
-    IM_ASSERT(bd_baked_data != nullptr);
-    IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
-
-    FT_New_Size(bd_font_data->FtFace, &bd_baked_data->FtSize);
-    FT_Activate_Size(bd_baked_data->FtSize);
-
     // Vuhdo 2017: "I'm not sure how to deal with font sizes properly. As far as I understand, currently ImGui assumes that the 'pixel_height'
     // is a maximum height of an any given glyph, i.e. it's the sum of font's ascender and descender. Seems strange to me.
     // FT_Set_Pixel_Sizes() doesn't seem to get us the same result."
@@ -447,12 +473,30 @@ static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* s
     req.height = (uint32_t)(size * 64 * rasterizer_density);
     req.horiResolution = 0;
     req.vertResolution = 0;
-    FT_Request_Size(bd_font_data->FtFace, &req);
+    FT_Request_Size(face, &req);
+}
+
+static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src)
+{
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    bd_font_data->BakedLastActivated = baked;
+
+    // We use one FT_Size per (source + baked) combination.
+    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+    IM_ASSERT(bd_baked_data != nullptr);
+    IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
+
+    FT_New_Size(bd_font_data->FtFace, &bd_baked_data->FtSize);
+    FT_Activate_Size(bd_baked_data->FtSize);
+    ImGui_ImplFreeType_RequestSize(bd_font_data, bd_font_data->FtFace, src, baked);
+
+    ImGui_ImplFreeType_SetDistanceFieldSpread(atlas, (ImGui_ImplFreeType_Data*)atlas->FontLoaderData); // In case flags were set after loader init
 
     // Output
     if (src->MergeMode == false)
     {
         // Read metrics
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
         FT_Size_Metrics metrics = bd_baked_data->FtSize->metrics;
         const float scale = 1.0f / rasterizer_density;
         baked->Ascent     = (float)FT_CEIL(metrics.ascender) * scale;       // The pixel extents above the baseline in pixels (typically positive).
@@ -475,13 +519,58 @@ static void ImGui_ImplFreeType_FontBakedDestroy(ImFontAtlas* atlas, ImFontConfig
     bd_baked_data->~ImGui_ImplFreeType_FontSrcBakedData(); // ~IM_PLACEMENT_DELETE()
 }
 
-static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+static bool ImGui_ImplFreeType_FontBakedThreadInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, void* loader_data_for_thread)
 {
+    IM_UNUSED(loader_data_for_baked_src);
+    ImGui_ImplFreeType_Data* bd = (ImGui_ImplFreeType_Data*)atlas->FontLoaderData;
     ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
-    if (glyph_index == 0)
+    ImGui_ImplFreeType_FontSrcThreadData* bd_thread_data = (ImGui_ImplFreeType_FontSrcThreadData*)loader_data_for_thread;
+    IM_ASSERT(bd_thread_data != nullptr);
+    IM_PLACEMENT_NEW(bd_thread_data) ImGui_ImplFreeType_FontSrcThreadData();
+
+    // Faces are created and destroyed on main thread (FT_New_Face()/FT_Done_Face() are not thread-safe), then each is used by a single job.
+    // Reuse a face released by a previous job when possible: asynchronous loading creates one job per batch of glyphs.
+    FT_Face face = nullptr;
+    if (bd_font_data->ThreadFacesPool.Size > 0)
+    {
+        face = bd_font_data->ThreadFacesPool.back();
+        bd_font_data->ThreadFacesPool.pop_back();
+    }
+    else
+    {
+        FT_Error error = FT_New_Memory_Face(bd->Library, (uint8_t*)src->FontData, (FT_Long)src->FontDataSize, (FT_Long)src->FontNo, &face);
+        if (error != 0)
+            return false;
+        if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+        {
+            FT_Done_Face(face);
+            return false;
+        }
+    }
+    if (FT_New_Size(face, &bd_thread_data->FtSize) != 0)
+    {
+        bd_font_data->ThreadFacesPool.push_back(face);
         return false;
+    }
+    bd_thread_data->FtFace = face;
+    FT_Activate_Size(bd_thread_data->FtSize);
+    ImGui_ImplFreeType_RequestSize(bd_font_data, bd_thread_data->FtFace, src, baked);
+    return true;
+}
 
+static void ImGui_ImplFreeType_FontBakedThreadDestroy(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_thread)
+{
+    IM_UNUSED(atlas);
+    IM_UNUSED(baked);
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    ImGui_ImplFreeType_FontSrcThreadData* bd_thread_data = (ImGui_ImplFreeType_FontSrcThreadData*)loader_data_for_thread;
+    FT_Done_Size(bd_thread_data->FtSize);
+    bd_font_data->ThreadFacesPool.push_back(bd_thread_data->FtFace);
+    bd_thread_data->~ImGui_ImplFreeType_FontSrcThreadData(); // ~IM_PLACEMENT_DELETE()
+}
+
+static void ImGui_ImplFreeType_ActivateBakedSize(ImGui_ImplFreeType_FontSrcData* bd_font_data, ImFontBaked* baked, void* loader_data_for_baked_src)
+{
     if (bd_font_data->BakedLastActivated != baked) // <-- could use id
     {
         // Activate current size
@@ -489,26 +578,40 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         FT_Activate_Size(bd_baked_data->FtSize);
         bd_font_data->BakedLastActivated = baked;
     }
+}
+
+// Rasterize into 'out_bitmap' without touching the atlas. When 'loader_data_for_thread' is set, only its FT_Face is used.
+static bool ImGui_ImplFreeType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, void* loader_data_for_thread, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontGlyphBitmap* out_bitmap)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    FT_Face face;
+    if (loader_data_for_thread != nullptr)
+    {
+        face = ((ImGui_ImplFreeType_FontSrcThreadData*)loader_data_for_thread)->FtFace;
+    }
+    else
+    {
+        face = bd_font_data->FtFace;
+        ImGui_ImplFreeType_ActivateBakedSize(bd_font_data, baked, loader_data_for_baked_src);
+    }
 
-    const FT_Glyph_Metrics* metrics = ImGui_ImplFreeType_LoadGlyph(bd_font_data, codepoint);
+    const FT_Glyph_Metrics* metrics = ImGui_ImplFreeType_LoadGlyph(bd_font_data, face, codepoint);
     if (metrics == nullptr)
         return false;
 
-    FT_Face face = bd_font_data->FtFace;
     FT_GlyphSlot slot = face->glyph;
+    if ((atlas->Flags & ImFontAtlasFlags_DistanceField) && slot->format != FT_GLYPH_FORMAT_OUTLINE)
+        return false; // Bitmap/color glyphs can't be converted to distance fields: treat as missing so fallback is used
     const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
-
-    // Load metrics only mode
     const float advance_x = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance_x;
-        return true;
-    }
 
     // Render glyph into a bitmap (currently held by FreeType)
     FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
+#if IMGUI_FREETYPE_VERSION >= 21100
+    if (atlas->Flags & ImFontAtlasFlags_DistanceField)
+        render_mode = FT_RENDER_MODE_SDF; // 128 on edges, 'DistanceFieldSpread' pixels of padding around the glyph.
+#endif
     FT_Error error = FT_Render_Glyph(slot, render_mode);
     const FT_Bitmap* ft_bitmap = &slot->bitmap;
     if (error != 0 || ft_bitmap == nullptr)
@@ -522,21 +625,10 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
     out_glyph->Codepoint = codepoint;
     out_glyph->AdvanceX = advance_x;
 
-    // Pack and retrieve position inside texture atlas
+    // Render pixels to output bitmap. Packing and retrieving position inside texture atlas is done by caller.
     if (is_visible)
     {
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
-        // Render pixels to our temporary buffer
-        atlas->Builder->TempBuffer.resize(w * h * 4);
-        uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
+        uint32_t* temp_buffer = (uint32_t*)(void*)out_bitmap->AllocPixels(w, h, ImTextureFormat_RGBA32);
         ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
 
         const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
@@ -551,21 +643,50 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         float recip_v = 1.0f / rasterizer_density;
 
         // Register glyph
-        float glyph_off_x = (float)face->glyph->bitmap_left;
-        float glyph_off_y = (float)-face->glyph->bitmap_top;
+        float glyph_off_x = (float)slot->bitmap_left;
+        float glyph_off_y = (float)-slot->bitmap_top;
         out_glyph->X0 = glyph_off_x * recip_h + font_off_x;
         out_glyph->Y0 = glyph_off_y * recip_v + font_off_y;
         out_glyph->X1 = (glyph_off_x + w) * recip_h + font_off_x;
         out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
         out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
-        out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
     }
 
     return true;
 }
 
+static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
+    if (glyph_index == 0)
+        return false;
+
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        ImGui_ImplFreeType_ActivateBakedSize(bd_font_data, baked, loader_data_for_baked_src);
+        if (ImGui_ImplFreeType_LoadGlyph(bd_font_data, bd_font_data->FtFace, codepoint) == nullptr)
+            return false;
+        if ((atlas->Flags & ImFontAtlasFlags_DistanceField) && bd_font_data->FtFace->glyph->format != FT_GLYPH_FORMAT_OUTLINE)
+            return false; // Same as ImGui_ImplFreeType_FontBakedRasterizeGlyph()
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+        *out_advance_x = (bd_font_data->FtFace->glyph->advance.x / FT_SCALEFACTOR) / rasterizer_density;
+        return true;
+    }
+
+    // Rasterize then pack and retrieve position inside texture atlas
+    atlas->Builder->TempBuffer.resize(0);
+    ImFontGlyphBitmap bitmap(&atlas->Builder->TempBuffer);
+    if (!ImGui_ImplFreeType_FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, nullptr, codepoint, out_glyph, &bitmap))
+        return false;
+    if (out_glyph->Visible && !ImFontAtlasBakedPackFontGlyph(atlas, baked, src, out_glyph, &bitmap))
+        return false;
+    return true;
+}
+
 static bool ImGui_ImplFreetype_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint)
 {
     IM_UNUSED(atlas);
@@ -586,7 +707,11 @@ const ImFontLoader* ImGuiFreeType::GetFontLoader()
     loader.FontBakedInit = ImGui_ImplFreeType_FontBakedInit;
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
+    loader.FontBakedThreadInit = ImGui_ImplFreeType_FontBakedThreadInit;
+    loader.FontBakedThreadDestroy = ImGui_ImplFreeType_FontBakedThreadDestroy;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplFreeType_FontBakedRasterizeGlyph;
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
+    loader.FontBakedThreadLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcThreadData);
     return &loader;
 }
 
@@ -0,0 +1,933 @@
+// dear imgui: headless self-tests
+// (compile and link imgui, create contexts, run small scripted scenarios with NO GRAPHICS OUTPUT, check their output)
+
+// This is built on the same principle as examples/example_null/ and misc/benchmark/: no platform backend, no renderer backend.
+// Those are not meant to replace the Dear ImGui Test Engine (https://github.com/ocornut/imgui_test_engine), which
+// drives the UI like an user would. They cover lower level features whose correctness can't be verified by just
+// compiling and running an application: draw data serialization, worker threads, etc.
+
+// Usage:
+//   imgui_tests [NAME] [--list]
+// Output:
+//   One line per test on stdout. Failed checks are reported on stderr. Exit code is 1 if any test failed.
+
+// Changelog:
+// - v0.10: Initial version. Tests: drawstream_roundtrip.
+// - v0.11: Added test: password_font.
+// - v0.12: Added test: text_layout_cache.
+// - v0.13: Added test: font_parallel_for.
+// - v0.14: Added test: font_async.
+// - v0.15: Added test: font_atlas_make_space.
+// - v0.16: Added test: font_atlas_budget.
+// - v0.17: Added test: font_compressed_texture.
+// - v0.18: Added test: frame_arena.
+// - v0.19: Added test: windows_hit_grid.
+// - v0.20: Added test: text_layout_cache_output.
+// - v0.21: Added test: hash_str.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "../drawstream/imgui_drawstream.h"
+#include <stdint.h>     // intptr_t
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// [SECTION] Helpers
+//-----------------------------------------------------------------------------
+
+#define IM_CHECK(_EXPR)     do { if (!(_EXPR)) { fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); return false; } } while (0)
+
+// Create a context with a fixed display size, ready for NewFrame(). Make it current.
+static ImGuiContext* TestCreateContext(ImGuiBackendFlags backend_flags = 0, ImFontAtlas* shared_font_atlas = NULL)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(shared_font_atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset | backend_flags;
+    io.DisplaySize = ImVec2(1280, 720);
+    io.DeltaTime = 1.0f / 60.0f;
+    return ctx;
+}
+
+// Emulate what a renderer backend does with textures: acknowledge requests without reading pixels.
+static void TestUpdateTextures(ImDrawData* draw_data)
+{
+    if (draw_data->Textures == NULL)
+        return;
+    for (ImTextureData* tex : *draw_data->Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)tex->UniqueID + 1);
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+// Render and process texture requests. Return draw data of the frame.
+static ImDrawData* TestEndFrame()
+{
+    ImGui::Render();
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    TestUpdateTextures(draw_data);
+    return draw_data;
+}
+
+// Count vertices in draw_list->VtxBuffer[vtx_begin..] whose UV is the top-left UV of the glyph of 'c'
+// (every glyph quad has one such vertex). The reference UV is stored into an ImDrawVert as well, so it is
+// quantized the same way with IMGUI_USE_COMPACT_DRAWVERT.
+static int TestCountGlyphQuads(const ImDrawList* draw_list, int vtx_begin, ImFontBaked* baked, ImWchar c)
+{
+    const ImFontGlyph* glyph = baked->FindGlyph(c);
+    ImDrawVert ref_vtx;
+    ref_vtx.uv = ImVec2(glyph->U0, glyph->V0);
+    const float ref_u = ref_vtx.uv.x, ref_v = ref_vtx.uv.y;
+    int count = 0;
+    for (int vtx_n = vtx_begin; vtx_n < draw_list->VtxBuffer.Size; vtx_n++)
+        if ((float)draw_list->VtxBuffer[vtx_n].uv.x == ref_u && (float)draw_list->VtxBuffer[vtx_n].uv.y == ref_v)
+            count++;
+    return count;
+}
+
+// Compare output buffers and commands of two draw lists.
+static bool TestCompareDrawLists(const ImDrawList* a, const ImDrawList* b)
+{
+    IM_CHECK(a->VtxBuffer.Size == b->VtxBuffer.Size);
+    IM_CHECK(a->VtxBuffer.Size == 0 || memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0);
+    IM_CHECK(a->GetIdxSize() == b->GetIdxSize());
+    IM_CHECK(a->GetIdxCount() == b->GetIdxCount());
+    IM_CHECK(a->GetIdxCount() == 0 || memcmp(a->GetIdxData(), b->GetIdxData(), (size_t)(a->GetIdxCount() * a->GetIdxSize())) == 0);
+    IM_CHECK(a->CmdBuffer.Size == b->CmdBuffer.Size);
+    for (int cmd_n = 0; cmd_n < a->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd_a = a->CmdBuffer[cmd_n];
+        const ImDrawCmd& cmd_b = b->CmdBuffer[cmd_n];
+        IM_CHECK(memcmp(&cmd_a.ClipRect, &cmd_b.ClipRect, sizeof(ImVec4)) == 0);
+        IM_CHECK(cmd_a.GetTexID() == cmd_b.GetTexID());
+        IM_CHECK(cmd_a.VtxOffset == cmd_b.VtxOffset && cmd_a.IdxOffset == cmd_b.IdxOffset && cmd_a.ElemCount == cmd_b.ElemCount);
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Tests: widgets
+//-----------------------------------------------------------------------------
+
+// Password fields render '*' for every character, whether or not glyphs of the text were already
+// used (and cached for the ASCII fast path of RenderText()), and other text is unaffected.
+static bool Test_Widgets_PasswordFont()
+{
+    static const char* password = "hunter2";
+    for (int text_first = 0; text_first < 2; text_first++)
+    {
+        TestCreateContext();
+        char buf[32];
+        strcpy(buf, password);
+        bool ok = true;
+        for (int frame_n = 0; frame_n < 4 && ok; frame_n++)
+        {
+            ImGui::NewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0, 0));
+            ImGui::SetNextWindowSize(ImVec2(400, 200));
+            ImGui::Begin("Password", NULL, ImGuiWindowFlags_NoDecoration);
+            ImDrawList* draw_list = ImGui::GetWindowDrawList();
+            ImFontBaked* baked = ImGui::GetFontBaked();
+            if (text_first)
+                ImGui::TextUnformatted(password);
+
+            const int vtx_begin = draw_list->VtxBuffer.Size;
+            ImGui::InputText("##password", buf, IM_ARRAYSIZE(buf), ImGuiInputTextFlags_Password);
+            const int vtx_end = draw_list->VtxBuffer.Size;
+            ImGui::TextUnformatted(password);
+            if (frame_n > 0) // First frame of a window doesn't render
+            {
+                int stars = TestCountGlyphQuads(draw_list, vtx_begin, baked, '*');
+                int others = 0;
+                for (const char* p = password; *p; p++)
+                    others += TestCountGlyphQuads(draw_list, vtx_begin, baked, (ImWchar)*p);
+                int stars_after = TestCountGlyphQuads(draw_list, vtx_end, baked, '*');
+                ok = (stars == (int)strlen(password) && stars_after == 0 && others == (int)strlen(password));
+                if (!ok)
+                    fprintf(stderr, "text_first=%d frame=%d: %d '*' quads, %d '*' quads after field, %d other glyph quads\n", text_first, frame_n, stars, stars_after, others);
+            }
+            ImGui::End();
+            TestEndFrame();
+        }
+        ImGui::DestroyContext();
+        IM_CHECK(ok);
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Tests: hashing
+//-----------------------------------------------------------------------------
+
+// Reference ImHashStr()/ImHashData(): CRC32c one byte at a time (bitwise, independently from lookup tables and CRC32 instructions),
+// with "###" resetting to seed. data_size == 0 means zero-terminated.
+static ImGuiID TestHashReference(const char* data_p, size_t data_size, ImGuiID seed, bool handle_triple_hash)
+{
+    const ImU32 seed_inv = ~seed;
+    ImU32 crc = seed_inv;
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end = (data_size != 0) ? data + data_size : data + strlen(data_p);
+    for (; data < data_end; data++)
+    {
+        if (handle_triple_hash && data[0] == '#' && data_end - data >= 3 && data[1] == '#' && data[2] == '#')
+            crc = seed_inv;
+        crc ^= data[0];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0x82F63B78 & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// ImHashStr() and ImHashData() match the reference CRC32c, including with IMGUI_USE_FAST_CRC32 (8 bytes per step):
+// "###" and other runs of '#' at every offset around 8-byte boundaries, from aligned and unaligned addresses.
+static bool Test_Hash_Str()
+{
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+    return true; // Reference is CRC32c
+#else
+    char storage[64];
+    unsigned int rand_seed = 0x9E3779B9;
+    for (int len = 1; len <= 40; len++)
+        for (int hash_count = 1; hash_count <= 4; hash_count++)
+            for (int hash_pos = -1; hash_pos < len; hash_pos++)
+                for (int align = 0; align < 8; align += 3)
+                {
+                    char* buf = storage + align;
+                    for (int n = 0; n < len; n++)
+                    {
+                        rand_seed = rand_seed * 1664525u + 1013904223u;
+                        buf[n] = (char)('a' + (rand_seed >> 24) % 26);
+                    }
+                    for (int n = hash_pos; n >= 0 && n < hash_pos + hash_count && n < len; n++)
+                        buf[n] = '#';
+                    buf[len] = 0;
+                    const ImGuiID seeds[] = { 0, 0x12345678 };
+                    for (ImGuiID seed : seeds)
+                    {
+                        const ImGuiID ref = TestHashReference(buf, (size_t)len, seed, true);
+                        IM_CHECK(ImHashStr(buf, (size_t)len, seed) == ref);
+                        IM_CHECK(ImHashStr(buf, 0, seed) == ref); // Zero-terminated
+                        IM_CHECK(ImHashData(buf, (size_t)len, seed) == TestHashReference(buf, (size_t)len, seed, false));
+                    }
+                }
+    IM_CHECK(ImHashStr("Label###ID") == ImHashStr("Other###ID"));
+    return true;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Tests: memory
+//-----------------------------------------------------------------------------
+
+// ImGuiFrameArena: aligned allocations, blocks merged into one reused by next frames, memory released after a spike.
+// Window stacks stored in the arena (ImFrameVector<>) don't reallocate once the arena is steady.
+static bool Test_Memory_FrameArena()
+{
+    ImGuiFrameArena arena;
+    for (int frame_n = 0; frame_n < 3; frame_n++)
+    {
+        for (int n = 0; n < 100; n++)
+        {
+            const size_t size = (size_t)(n * 7 + 1);
+            void* p = arena.alloc(size);
+            IM_CHECK(((intptr_t)p & 15) == 0);
+            memset(p, 0xFF, size);
+        }
+        IM_CHECK(frame_n == 0 ? arena.Blocks.Size > 1 : arena.Blocks.Size == 1);
+        arena.reset();
+        IM_CHECK(arena.Blocks.Size == 1 && arena.UsedSize == 0);
+    }
+    const size_t high_water_size = arena.HighWaterSize;
+    IM_CHECK(high_water_size > 0 && arena.capacity() == high_water_size);
+
+    arena.alloc(8 * 1024 * 1024); // Spike
+    arena.reset();
+    IM_CHECK(arena.HighWaterSize >= 8 * 1024 * 1024);
+    arena.alloc(100);
+    arena.reset();
+    IM_CHECK(arena.capacity() == 0); // Released after a frame using much less
+    arena.clear();
+
+    TestCreateContext();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    char* block_data = NULL;
+    for (int frame_n = 0; frame_n < 5; frame_n++)
+    {
+        ImGui::NewFrame();
+        ImGui::Begin("Window");
+        for (int n = 0; n < 100; n++)
+            ImGui::PushItemWidth((float)(n + 1));
+        for (int n = 99; n >= 0; n--)
+        {
+            IM_CHECK(ImGui::CalcItemWidth() == (float)(n + 1));
+            ImGui::PopItemWidth();
+        }
+        ImGui::End();
+        IM_CHECK(g.FrameArena.UsedSize > 0);
+        if (frame_n >= 3)
+            IM_CHECK(g.FrameArena.Blocks.Size == 1 && g.FrameArena.Blocks[0].Data == block_data);
+        block_data = g.FrameArena.Blocks.Size == 1 ? g.FrameArena.Blocks[0].Data : NULL;
+        TestEndFrame();
+    }
+    ImGui::DestroyContext();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Tests: windows
+//-----------------------------------------------------------------------------
+
+// Compare FindHoveredWindowEx() results using the hit grid with results of the linear lookup, at random positions.
+static bool TestCompareHitGridLookups(unsigned int* seed, int queries_count)
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    IM_CHECK(g.WindowsHitGrid.Valid);
+    for (int n = 0; n < queries_count; n++)
+    {
+        *seed = *seed * 1664525u + 1013904223u;
+        const ImVec2 pos((float)((*seed >> 8) % 1400) - 60.0f, (float)((*seed >> 20) % 840) - 60.0f);
+        for (int find_first = 0; find_first < 2; find_first++)
+        {
+            ImGuiWindow* grid_hovered = NULL;
+            ImGuiWindow* grid_hovered_under_moving = NULL;
+            ImGuiWindow* linear_hovered = NULL;
+            ImGuiWindow* linear_hovered_under_moving = NULL;
+            ImGui::FindHoveredWindowEx(pos, find_first != 0, &grid_hovered, &grid_hovered_under_moving);
+            g.WindowsHitGrid.Valid = false;
+            ImGui::FindHoveredWindowEx(pos, find_first != 0, &linear_hovered, &linear_hovered_under_moving);
+            g.WindowsHitGrid.Valid = true;
+            IM_CHECK(grid_hovered == linear_hovered);
+            IM_CHECK(find_first || grid_hovered_under_moving == linear_hovered_under_moving);
+        }
+    }
+    return true;
+}
+
+// io.ConfigWindowsHitGrid: same hovered window as the linear lookup with many overlapping windows, children, hit test holes
+// and windows ignoring inputs. Grid stays valid across frames and during a frame until a window moves.
+static bool Test_Windows_HitGrid()
+{
+    TestCreateContext();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    ImGui::GetIO().ConfigWindowsHitGrid = true;
+    ImGui::GetIO().AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+
+    const int windows_count = 100;
+    ImVec2 windows_pos[windows_count];
+    unsigned int seed = 0x12345678;
+    for (int n = 0; n < windows_count; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        windows_pos[n] = ImVec2((float)((seed >> 8) % 1300) - 100.0f, (float)((seed >> 20) % 760) - 100.0f);
+    }
+
+    for (int frame_n = 0; frame_n < 12; frame_n++)
+    {
+        // Move a few windows on some frames
+        const bool move_windows = (frame_n == 6 || frame_n == 9);
+        if (move_windows)
+            for (int n = 0; n < windows_count; n += 7)
+                windows_pos[n] = ImVec2(windows_pos[n].x + 13.0f, windows_pos[n].y - 5.0f);
+
+        ImGui::NewFrame();
+        for (int n = 0; n < windows_count; n++)
+        {
+            ImGuiWindowFlags flags = ImGuiWindowFlags_NoSavedSettings;
+            if (n % 5 == 1)
+                flags |= ImGuiWindowFlags_NoMouseInputs;
+            if (n % 3 == 2)
+                flags |= ImGuiWindowFlags_NoResize;
+            ImGui::SetNextWindowPos(windows_pos[n], move_windows ? ImGuiCond_Always : ImGuiCond_Appearing);
+            ImGui::SetNextWindowSize(ImVec2(60.0f + (float)(n % 4) * 45.0f, 50.0f + (float)(n % 6) * 30.0f), ImGuiCond_Appearing);
+            char name[32];
+            snprintf(name, IM_ARRAYSIZE(name), "Window %d", n);
+            ImGui::Begin(name, NULL, flags);
+            if (n % 4 == 3)
+                ImGui::SetWindowHitTestHole(ImGui::GetCurrentWindow(), ImVec2(ImGui::GetWindowPos().x + 10.0f, ImGui::GetWindowPos().y + 10.0f), ImVec2(30.0f, 20.0f));
+            if (n % 6 == 0)
+            {
+                ImGui::BeginChild("Child", ImVec2(40.0f, 30.0f), ImGuiChildFlags_Borders);
+                ImGui::EndChild();
+            }
+            ImGui::End();
+        }
+
+        // Queries made during the frame use the grid as long as windows didn't move
+        if (frame_n >= 3)
+        {
+            IM_CHECK(g.WindowsHitGrid.Valid == !move_windows);
+            if (g.WindowsHitGrid.Valid)
+                IM_CHECK(TestCompareHitGridLookups(&seed, 1000));
+        }
+        TestEndFrame();
+        IM_CHECK(g.WindowsHitGrid.Valid && g.WindowsHitGrid.CellsX > 1);
+        IM_CHECK(TestCompareHitGridLookups(&seed, 1000));
+    }
+    ImGui::DestroyContext();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Tests: fonts
+//-----------------------------------------------------------------------------
+
+// Text layout cache (io.ConfigTextLayoutCache) stays bounded when text keeps changing, and never evicts text used every frame.
+static bool Test_Fonts_TextLayoutCache()
+{
+    TestCreateContext();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    ImGui::NewFrame();
+    const ImVec2 ref_size = ImGui::CalcTextSize("Hello world"); // Not cached
+    TestEndFrame();
+    ImGui::GetIO().ConfigTextLayoutCache = true;
+    char buf[64];
+    int max_entries = 0;
+    bool ok = true;
+    for (int frame_n = 0; frame_n < 100 && ok; frame_n++)
+    {
+        ImGui::NewFrame();
+        max_entries = ImMax(max_entries, g.TextLayoutCache.Size);
+        for (int n = 0; n < 1000; n++)
+        {
+            snprintf(buf, IM_ARRAYSIZE(buf), "Frame %d item %d", frame_n, n);
+            ImGui::CalcTextSize(buf);
+        }
+        ok = (ImGui::CalcTextSize("Hello world").x == ref_size.x);
+        TestEndFrame();
+    }
+    IM_CHECK(ok);
+    IM_CHECK(max_entries <= IM_TEXTLAYOUT_CACHE_SIZE * 2);
+
+    // More text used every frame than cache size
+    const int stable_count = IM_TEXTLAYOUT_CACHE_SIZE + 1000;
+    for (int frame_n = 0; frame_n < 4; frame_n++)
+    {
+        ImGui::NewFrame();
+        for (int n = 0; n < stable_count; n++)
+        {
+            snprintf(buf, IM_ARRAYSIZE(buf), "Item %d", n);
+            ImGui::CalcTextSize(buf);
+        }
+        TestEndFrame();
+    }
+    ImGui::NewFrame();
+    IM_CHECK(g.TextLayoutCacheMissesLastFrame == 0 && g.TextLayoutCacheHitsLastFrame >= stable_count);
+    IM_CHECK(g.TextLayoutCache.Size >= stable_count);
+    TestEndFrame();
+    ImGui::DestroyContext();
+    return true;
+}
+
+// Text rendered with io.ConfigTextLayoutCache outputs the same vertices as without it: wrapped text, multiple lines,
+// non-ASCII text, fractional font size, text clipped by window and CPU fine clipping. CalcTextSize() only caches size.
+static bool Test_Fonts_TextLayoutCacheOutput()
+{
+    TestCreateContext();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    ImFontConfig font_cfg; // No pixel snapping: fractional advances
+    ImFont* font = ImGui::GetIO().Fonts->AddFontDefault(&font_cfg);
+    ImDrawList* ref_draw_list = NULL;
+    for (int frame_n = 0; frame_n < 6; frame_n++)
+    {
+        ImGui::GetIO().ConfigTextLayoutCache = (frame_n >= 4); // Frame 4 builds layouts, frame 5 uses cached layouts
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(347.0f, 91.0f));
+        ImGui::SetNextWindowSize(ImVec2(311.0f, 260.0f));
+        ImGui::Begin("Text", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::PushFont(font, 17.3f);
+        ImGui::TextWrapped("The quick brown fox jumps over the lazy dog, then keeps jumping until this line wraps a few times in the window.");
+        ImGui::TextUnformatted("Line one\n\nLine three\tafter tab\nVoil\xC3\xA0 d\xC3\xA9j\xC3\xA0 vu");
+        ImGui::Button("A label much longer than its button", ImVec2(90.0f, 0.0f));
+        for (int n = 0; n < 20; n++)
+            ImGui::Text("Item %d: %.3f", n, n * 1.37f);
+        ImGui::PopFont();
+        ImGui::End();
+        if (frame_n == 4)
+        {
+            IM_CHECK(ImGui::CalcTextSize("Only measured").x > 0.0f);
+            ImGuiTextLayoutCacheEntry* entry = g.TextLayoutCacheLastEntry;
+            IM_CHECK(entry != NULL && !entry->HasGlyphs && entry->Layout.Glyphs.Size == 0);
+        }
+        if (frame_n == 5)
+            IM_CHECK(g.TextLayoutCacheMisses == 0 && g.TextLayoutCacheHits > 0);
+        TestEndFrame();
+
+        ImDrawList* draw_list = ImGui::FindWindowByName("Text")->DrawList;
+        if (frame_n == 3)
+            ref_draw_list = draw_list->CloneOutput();
+        else if (frame_n >= 4)
+            IM_CHECK(TestCompareDrawLists(ref_draw_list, draw_list));
+    }
+    IM_DELETE(ref_draw_list);
+    ImGui::DestroyContext();
+    return true;
+}
+
+// ImFontAtlas::ParallelFor implementation running jobs on std::thread, counting calls in *user_data.
+static void TestParallelFor(int jobs_count, void (*job_func)(int job_index, void* job_data), void* job_data, void* user_data)
+{
+    std::thread threads[8];
+    IM_ASSERT(jobs_count <= IM_ARRAYSIZE(threads));
+    (*(int*)user_data)++;
+    for (int job_n = 1; job_n < jobs_count; job_n++)
+        threads[job_n] = std::thread(job_func, job_n, job_data);
+    job_func(0, job_data);
+    for (int job_n = 1; job_n < jobs_count; job_n++)
+        threads[job_n].join();
+}
+
+// Loading a glyph range with ImFontAtlas::ParallelFor gives the same glyphs and texture as loading them one by one.
+static bool Test_Fonts_ParallelFor()
+{
+    ImVector<ImWchar> codepoints;
+    for (ImWchar c = 0x20; c < 0x180; c++) // Includes codepoints missing from default font
+        codepoints.push_back(c);
+
+    ImVector<ImFontGlyph> glyphs[2];
+    ImVector<unsigned char> pixels[2];
+    int tex_width[2], tex_height[2];
+    int parallel_for_calls = 0;
+    for (int use_jobs = 0; use_jobs < 2; use_jobs++)
+    {
+        TestCreateContext();
+        ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+        if (use_jobs)
+        {
+            atlas->ParallelFor = TestParallelFor;
+            atlas->ParallelForUserData = &parallel_for_calls;
+            atlas->ParallelForJobsCount = 4;
+        }
+        ImGui::NewFrame();
+        ImFontBaked* baked = ImGui::GetFontBaked();
+        const int loaded_count = ImFontAtlasBakedLoadGlyphs(atlas, baked, codepoints.Data, codepoints.Size);
+        glyphs[use_jobs] = baked->Glyphs;
+        ImTextureData* tex = atlas->TexData;
+        tex_width[use_jobs] = tex->Width;
+        tex_height[use_jobs] = tex->Height;
+        pixels[use_jobs].resize(tex->GetSizeInBytes());
+        memcpy(pixels[use_jobs].Data, tex->GetPixels(), (size_t)tex->GetSizeInBytes());
+        TestEndFrame();
+        ImGui::DestroyContext();
+        IM_CHECK(loaded_count > 64);
+    }
+    IM_CHECK(parallel_for_calls == 1);
+    IM_CHECK(glyphs[0].Size == glyphs[1].Size);
+    IM_CHECK(memcmp(glyphs[0].Data, glyphs[1].Data, (size_t)glyphs[0].size_in_bytes()) == 0);
+    IM_CHECK(tex_width[0] == tex_width[1] && tex_height[0] == tex_height[1]);
+    IM_CHECK(memcmp(pixels[0].Data, pixels[1].Data, (size_t)pixels[0].Size) == 0);
+    return true;
+}
+
+// ImFontAtlas::RunAsync implementation starting a std::thread per job. Jobs are delayed so they are still running in next frames.
+static void TestRunAsync(void (*job_func)(void* job_data), void* job_data, void* user_data)
+{
+    std::vector<std::thread>* threads = (std::vector<std::thread>*)user_data;
+    threads->push_back(std::thread([=]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); job_func(job_data); }));
+}
+
+// Asynchronous glyph loading (ImFontAtlas::RunAsync): glyphs are loaded a few frames after being used, and jobs
+// in flight don't reference the context which started them: here it's destroyed while other context shares the atlas.
+static bool Test_Fonts_Async()
+{
+    std::vector<std::thread> threads;
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    atlas->AddFontDefault();
+    atlas->RunAsync = TestRunAsync;
+    atlas->RunAsyncUserData = &threads;
+    int atlas_frame_count = 0;
+
+    ImGuiContext* ctx_a = TestCreateContext(0, atlas);
+    ImGuiContext* ctx_b = TestCreateContext(0, atlas);
+    ImGui::SetCurrentContext(ctx_a);
+    bool loaded = false;
+    for (int frame_n = 0; frame_n < 200 && !loaded; frame_n++)
+    {
+        ImFontAtlasUpdateNewFrame(atlas, atlas_frame_count++, true); // Atlas not owned by a context
+        ImGui::NewFrame();
+        ImGui::Begin("Async");
+        ImGui::Text("Quick brown fox");
+        loaded = ImGui::GetFontBaked()->IsGlyphLoaded('Q');
+        IM_CHECK(frame_n > 0 || !loaded);
+        ImGui::End();
+        TestEndFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    IM_CHECK(loaded);
+
+    // Start jobs from context A then destroy it. Context B integrates their results.
+    for (int frame_n = 0; frame_n < 2; frame_n++)
+    {
+        ImFontAtlasUpdateNewFrame(atlas, atlas_frame_count++, true); // Start jobs on second frame
+        ImGui::NewFrame();
+        ImGui::PushFont(NULL, 40.0f);
+        ImGui::CalcTextSize("Quick brown fox");
+        ImGui::PopFont();
+        TestEndFrame();
+    }
+    IM_CHECK(atlas->Builder->AsyncBatches.Size > 0);
+    ImGui::DestroyContext(ctx_a);
+    ImGui::SetCurrentContext(ctx_b);
+    for (int frame_n = 0; frame_n < 200 && atlas->Builder->AsyncBatches.Size > 0; frame_n++)
+    {
+        ImFontAtlasUpdateNewFrame(atlas, atlas_frame_count++, true);
+        ImGui::NewFrame();
+        ImGui::PushFont(NULL, 40.0f);
+        ImGui::CalcTextSize("Quick brown fox");
+        ImGui::PopFont();
+        TestEndFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    IM_CHECK(atlas->Builder->AsyncBatches.Size == 0);
+
+    // Destroy last context, and atlas with it, with jobs in flight: waits for them.
+    for (int frame_n = 0; frame_n < 2; frame_n++)
+    {
+        ImFontAtlasUpdateNewFrame(atlas, atlas_frame_count++, true);
+        ImGui::NewFrame();
+        ImGui::PushFont(NULL, 60.0f);
+        ImGui::CalcTextSize("Quick brown fox");
+        ImGui::PopFont();
+        TestEndFrame();
+    }
+    IM_CHECK(atlas->Builder->AsyncBatches.Size > 0);
+    ImGui::DestroyContext(ctx_b);
+    for (std::thread& thread : threads)
+        thread.join();
+    return true;
+}
+
+// Making space in the atlas in the middle of a frame (e.g. packing a new glyph) doesn't modify pixels of the current texture,
+// which vertices emitted earlier in the frame may use. Here, discarding a large unused size leads to a repack.
+static bool Test_Fonts_AtlasMakeSpace()
+{
+    TestCreateContext();
+    static const char* text = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    for (int frame_n = 0; frame_n < 6; frame_n++)
+    {
+        ImGui::NewFrame();
+        if (frame_n < 2)
+        {
+            ImGui::PushFont(NULL, 40.0f); // Packed first, only used during 2 frames
+            ImGui::CalcTextSize(text);
+            ImGui::PopFont();
+        }
+        ImGui::CalcTextSize(text);
+        TestEndFrame();
+    }
+
+    ImGui::NewFrame();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImFontBaked* baked = ImGui::GetFontBaked();
+    const ImFontGlyph* glyph = baked->FindGlyph('A');
+    ImTextureData* tex = atlas->TexData;
+    const ImTextureRect r = *ImFontAtlasPackGetRect(atlas, glyph->PackId);
+    ImVector<unsigned char> pixels;
+    pixels.resize(r.w * r.h * tex->BytesPerPixel);
+    for (int y = 0; y < r.h; y++)
+        memcpy(pixels.Data + y * r.w * tex->BytesPerPixel, tex->GetPixelsAt(r.x, r.y + y), (size_t)(r.w * tex->BytesPerPixel));
+    ImFontAtlasTextureMakeSpace(atlas);
+    for (int y = 0; y < r.h; y++)
+        IM_CHECK(memcmp(pixels.Data + y * r.w * tex->BytesPerPixel, tex->GetPixelsAt(r.x, r.y + y), (size_t)(r.w * tex->BytesPerPixel)) == 0);
+    IM_CHECK(atlas->TexData != tex); // Repacked into a new texture
+    TestEndFrame();
+    ImGui::DestroyContext();
+    return true;
+}
+
+// Use a different font size every frame with a texture memory budget: eviction must only happen between frames, and bring texture back within budget.
+// Glyphs and sizes only used by draw lists recorded on worker threads (atlas is read-only) must not be evicted: they couldn't be reloaded.
+static bool Test_Fonts_AtlasMemoryBudget()
+{
+    TestCreateContext();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImDrawListSharedData thread_data;
+    ImGui::AddDrawListSharedDataForThread(&thread_data);
+    ImDrawList* thread_draw_list = IM_NEW(ImDrawList)(&thread_data);
+    static const char* thread_text = "Recorded on thread";
+    const float thread_font_size = 15.0f;
+
+    ImGui::NewFrame();
+    ImGui::PushFont(NULL, thread_font_size);
+    ImGui::CalcTextSize(thread_text); // Load glyphs on main thread
+    ImGui::PopFont();
+    TestEndFrame();
+    atlas->TexMaxMemorySize = ImFontAtlasTextureGetMemorySize(atlas, atlas->TexData->Width, atlas->TexData->Height);
+
+    for (int frame_n = 0; frame_n < 30; frame_n++)
+    {
+        ImGui::NewFrame();
+        IM_CHECK(ImFontAtlasTextureGetMemorySize(atlas, atlas->TexData->Width, atlas->TexData->Height) <= atlas->TexMaxMemorySize);
+        const int glyphs_evicted_count = atlas->Builder->GlyphsEvictedCount;
+        const int baked_evicted_count = atlas->Builder->BakedEvictedCount;
+        ImGui::PushFont(NULL, 20.0f + frame_n);
+        ImGui::CalcTextSize("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        ImGui::PopFont();
+        IM_CHECK(atlas->Builder->GlyphsEvictedCount == glyphs_evicted_count);
+        IM_CHECK(atlas->Builder->BakedEvictedCount == baked_evicted_count);
+
+        ImFont* font = ImGui::GetFont();
+        ImGui::BeginDrawListsRecordingOnThreads();
+        std::thread thread([&]() { thread_draw_list->AddText(font, thread_font_size, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, thread_text); });
+        thread.join();
+        ImGui::EndDrawListsRecordingOnThreads();
+        TestEndFrame();
+    }
+    IM_CHECK(atlas->Builder->BakedEvictedCount > 0);
+
+    ImGui::NewFrame();
+    ImFontBaked* baked = (ImFontBaked*)atlas->Builder->BakedMap.GetVoidPtr(ImFontAtlasBakedGetId(ImGui::GetFont()->FontId, thread_font_size, 1.0f));
+    IM_CHECK(baked != NULL);
+    for (const char* p = thread_text; *p != 0; p++)
+        IM_CHECK(baked->IsGlyphLoaded((ImWchar)*p));
+    TestEndFrame();
+
+    IM_DELETE(thread_draw_list);
+    ImGui::RemoveDrawListSharedDataForThread(&thread_data);
+    ImGui::DestroyContext();
+    return true;
+}
+
+// Decode a BC4 block (8 bytes) into 16 values, following the format specification (independently from the encoder in imgui_draw.cpp).
+static void TestDecodeBC4Block(const unsigned char* block, unsigned char* out_values)
+{
+    const int e0 = block[0], e1 = block[1];
+    int palette[8] = { e0, e1, 0, 0, 0, 0, 0, 255 };
+    if (e0 > e1)
+        for (int i = 2; i < 8; i++)
+            palette[i] = (int)(((8 - i) * e0 + (i - 1) * e1) / 7.0f + 0.5f);
+    else
+        for (int i = 2; i < 6; i++)
+            palette[i] = (int)(((6 - i) * e0 + (i - 1) * e1) / 5.0f + 0.5f);
+    ImU64 bits = 0;
+    for (int n = 0; n < 6; n++)
+        bits |= (ImU64)block[2 + n] << (n * 8);
+    for (int n = 0; n < 16; n++)
+        out_values[n] = (unsigned char)palette[(bits >> (n * 3)) & 7];
+}
+
+// ImFontAtlasFlags_CompressedTexture only encodes BC4 blocks when the backend supports them.
+// Decoded blocks match the alpha channel within half a palette step of their block (+1 for rounding), and glyphs are not lost.
+static bool Test_Fonts_AtlasCompressedTexture()
+{
+    for (int backend_bc4 = 0; backend_bc4 < 2; backend_bc4++)
+    {
+        TestCreateContext(backend_bc4 ? ImGuiBackendFlags_RendererHasTexturesBC4 : 0);
+        ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+        atlas->Flags |= ImFontAtlasFlags_CompressedTexture;
+        ImGui::NewFrame();
+        ImGui::CalcTextSize("Hello");
+        ImFontBaked* baked = ImGui::GetFontBaked();
+        TestEndFrame();
+        ImTextureData* tex = atlas->TexData;
+        IM_CHECK((tex->CompressedPixels != NULL) == (backend_bc4 != 0));
+        if (tex->CompressedPixels == NULL)
+        {
+            ImGui::DestroyContext();
+            continue;
+        }
+        IM_CHECK((tex->Width & 3) == 0 && (tex->Height & 3) == 0);
+
+        // Decode whole texture (encoded by EndFrame())
+        ImVector<unsigned char> decoded;
+        decoded.resize(tex->Width * tex->Height);
+        for (int block_y = 0; block_y < tex->Height; block_y += 4)
+            for (int block_x = 0; block_x < tex->Width; block_x += 4)
+            {
+                const unsigned char* block = (const unsigned char*)tex->GetCompressedPixelsAt(block_x, block_y);
+                unsigned char values[16];
+                TestDecodeBC4Block(block, values);
+                const int max_error = ImAbs((int)block[0] - (int)block[1]) / ((block[0] > block[1]) ? 14 : 10) + 2; // Half palette step, +1 for truncation, +1 for decoder rounding
+                for (int py = 0; py < 4; py++)
+                    for (int px = 0; px < 4; px++)
+                    {
+                        const unsigned char* src_p = (const unsigned char*)tex->GetPixelsAt(block_x + px, block_y + py);
+                        const int alpha = (tex->Format == ImTextureFormat_RGBA32) ? (int)((*(const ImU32*)src_p >> IM_COL32_A_SHIFT) & 0xFF) : (int)*src_p;
+                        const int value = values[py * 4 + px];
+                        if (ImAbs(value - alpha) > max_error)
+                            fprintf(stderr, "pixel (%d,%d): alpha %d decoded as %d, endpoints %d %d\n", block_x + px, block_y + py, alpha, value, block[0], block[1]);
+                        IM_CHECK(ImAbs(value - alpha) <= max_error);
+                        decoded[(block_y + py) * tex->Width + block_x + px] = (unsigned char)value;
+                    }
+            }
+
+        // Known glyph has solid and transparent pixels after decoding
+        const ImFontGlyph* glyph = baked->FindGlyph('H');
+        IM_CHECK(glyph != NULL && glyph->Visible);
+        int solid_count = 0, transparent_count = 0;
+        for (int y = (int)(glyph->V0 * tex->Height + 0.5f); y < (int)(glyph->V1 * tex->Height + 0.5f); y++)
+            for (int x = (int)(glyph->U0 * tex->Width + 0.5f); x < (int)(glyph->U1 * tex->Width + 0.5f); x++)
+            {
+                solid_count += (decoded[y * tex->Width + x] >= 128) ? 1 : 0;
+                transparent_count += (decoded[y * tex->Width + x] == 0) ? 1 : 0;
+            }
+        IM_CHECK(solid_count > 0 && transparent_count > 0);
+        ImGui::DestroyContext();
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Tests: misc/drawstream
+//-----------------------------------------------------------------------------
+
+
+// Encode frames of the demo window and a large mesh (promoted to 32-bit indices on some frames), decode and compare with source.
+static bool Test_DrawStream_RoundTrip()
+{
+    TestCreateContext(ImGuiBackendFlags_RendererHasIdx32);
+    ImDrawStreamEncoder encoder;
+    ImDrawStreamDecoder decoder;
+    ImVector<unsigned char> packet;
+    bool ok = true;
+    int delta_frames = 0;
+    for (int frame_n = 0; frame_n < 40 && ok; frame_n++)
+    {
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        ImGui::Begin("Mesh");
+        ImGui::Text("Frame %d", frame_n);
+        const int rects_count = (frame_n % 10 < 5) ? 20000 : 200; // 80K vertices: promoted to 32-bit indices
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        for (int n = 0; n < rects_count; n++)
+            draw_list->AddRectFilled(ImVec2((float)(n % 200), (float)(n / 200)), ImVec2((float)(n % 200 + 1), (float)(n / 200 + 1)), IM_COL32(n & 255, 0, 0, 255));
+        ImGui::End();
+        ImDrawData* draw_data = TestEndFrame();
+
+        encoder.EncodeFrame(draw_data, &packet);
+        IM_CHECK(decoder.DecodeFrame(packet.Data, (size_t)packet.Size));
+        if (encoder.LastFrameSize < encoder.LastFullSize / 2)
+            delta_frames++;
+        const ImDrawData* decoded = decoder.GetDrawData();
+        IM_CHECK(decoded != NULL);
+        IM_CHECK(decoded->CmdListsCount == draw_data->CmdListsCount);
+        IM_CHECK(decoded->TotalVtxCount == draw_data->TotalVtxCount && decoded->TotalIdxCount == draw_data->TotalIdxCount);
+        for (int list_n = 0; list_n < draw_data->CmdListsCount && ok; list_n++)
+            ok = TestCompareDrawLists(draw_data->CmdLists[list_n], decoded->CmdLists[list_n]);
+    }
+    ImGui::DestroyContext();
+    IM_CHECK(ok);
+    IM_CHECK(delta_frames > 20);
+
+    // Gap in frames: decoder needs a keyframe
+    ImDrawData draw_data;
+    ImDrawList draw_list(NULL);
+    draw_list.VtxBuffer.resize(4);
+    memset((void*)draw_list.VtxBuffer.Data, 0, (size_t)draw_list.VtxBuffer.size_in_bytes());
+    const ImDrawIdx indices[] = { 0, 1, 2, 0, 2, 3 };
+    for (ImDrawIdx idx : indices)
+        draw_list.IdxBuffer.push_back(idx);
+    draw_list.CmdBuffer.push_back(ImDrawCmd());
+    draw_list.CmdBuffer[0].ClipRect = ImVec4(0, 0, 100, 100);
+    draw_list.CmdBuffer[0].ElemCount = 6;
+    draw_data.CmdLists.push_back(&draw_list);
+    draw_data.CmdListsCount = 1;
+    encoder.EncodeFrame(&draw_data, &packet);
+    encoder.EncodeFrame(&draw_data, &packet);
+    IM_CHECK(!decoder.DecodeFrame(packet.Data, (size_t)packet.Size));
+    encoder.EncodeFrame(&draw_data, &packet, true);
+    IM_CHECK(decoder.DecodeFrame(packet.Data, (size_t)packet.Size));
+
+    // Truncated frame
+    encoder.EncodeFrame(&draw_data, &packet, true);
+    IM_CHECK(!decoder.DecodeFrame(packet.Data, (size_t)packet.Size - 1));
+    IM_CHECK(decoder.GetDrawData() == NULL);
+
+    // Index referencing a missing vertex, in a delta frame with unchanged commands
+    encoder.EncodeFrame(&draw_data, &packet, true);
+    IM_CHECK(decoder.DecodeFrame(packet.Data, (size_t)packet.Size));
+    draw_list.IdxBuffer[5] = 4;
+    encoder.EncodeFrame(&draw_data, &packet);
+    IM_CHECK(!decoder.DecodeFrame(packet.Data, (size_t)packet.Size));
+
+    // Command referencing missing indices
+    draw_list.IdxBuffer[5] = 3;
+    draw_list.CmdBuffer[0].ElemCount = 9;
+    encoder.EncodeFrame(&draw_data, &packet, true);
+    IM_CHECK(!decoder.DecodeFrame(packet.Data, (size_t)packet.Size));
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Main
+//-----------------------------------------------------------------------------
+
+struct TestEntry
+{
+    const char* Name;
+    const char* Desc;
+    bool        (*Func)();
+};
+
+static const TestEntry g_Tests[] =
+{
+    { "password_font",          "InputText(): password fields only render '*' glyphs",                     Test_Widgets_PasswordFont },
+    { "hash_str",               "ImHashStr(), ImHashData(): same as reference CRC32c, '###' at any offset, with or without IMGUI_USE_FAST_CRC32", Test_Hash_Str },
+    { "frame_arena",            "ImGuiFrameArena: alignment, reuse, release after a spike, window stacks stored in it", Test_Memory_FrameArena },
+    { "windows_hit_grid",       "io.ConfigWindowsHitGrid: same hovered windows as linear lookup, grid kept until windows move", Test_Windows_HitGrid },
+    { "text_layout_cache",      "io.ConfigTextLayoutCache: eviction keeps cache bounded, keeps text used every frame", Test_Fonts_TextLayoutCache },
+    { "text_layout_cache_output", "io.ConfigTextLayoutCache: same vertices as rendering without cache, CalcTextSize() only caches size", Test_Fonts_TextLayoutCacheOutput },
+    { "font_parallel_for",      "ImFontAtlas::ParallelFor: same glyphs and texture as loading one by one",  Test_Fonts_ParallelFor },
+    { "font_async",             "ImFontAtlas::RunAsync: glyphs load in background, jobs outlive context which started them", Test_Fonts_Async },
+    { "font_atlas_make_space",  "ImFontAtlasTextureMakeSpace(): current texture pixels are left untouched during a frame", Test_Fonts_AtlasMakeSpace },
+    { "font_atlas_budget",      "ImFontAtlas::TexMaxMemorySize: evict between frames, shrink texture back within budget", Test_Fonts_AtlasMemoryBudget },
+    { "font_compressed_texture","ImFontAtlasFlags_CompressedTexture: only encode BC4 blocks when backend supports them, decoded blocks match alpha", Test_Fonts_AtlasCompressedTexture },
+    { "drawstream_roundtrip",   "misc/drawstream: encode/decode frames, reject gaps and malformed frames",  Test_DrawStream_RoundTrip },
+};
+
+static void TestPrintUsage()
+{
+    fprintf(stderr, "Usage: imgui_tests [NAME] [--list]\n");
+    fprintf(stderr, "Tests:\n");
+    for (const TestEntry& test : g_Tests)
+        fprintf(stderr, "  %-24s %s\n", test.Name, test.Desc);
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const char* filter = NULL;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--list") == 0) { TestPrintUsage(); return 0; }
+        else if (argv[n][0] != '-' && filter == NULL) { filter = argv[n]; }
+        else { TestPrintUsage(); return 1; }
+    }
+
+    int tests_count = 0, tests_failed = 0;
+    for (const TestEntry& test : g_Tests)
+    {
+        if (filter != NULL && strcmp(filter, test.Name) != 0)
+            continue;
+        const bool ok = test.Func();
+        printf("%-24s %s\n", test.Name, ok ? "OK" : "FAILED");
+        tests_count++;
+        tests_failed += ok ? 0 : 1;
+    }
+    if (tests_count == 0)
+    {
+        fprintf(stderr, "Unknown test '%s'.\n", filter);
+        TestPrintUsage();
+        return 1;
+    }
+    printf("%d/%d tests passed.\n", tests_count - tests_failed, tests_count);
+    return (tests_failed > 0) ? 1 : 0;
+}